@@ -0,0 +1,414 @@
+// Micro-benchmarks: times the batch kernels and acceleration structures against the
+// straightforward per-element code they replace and prints the cost per item of each.
+//
+// Usage: bench [-filter name] [-count N] [-repeats N]
+//
+// -filter runs only the benchmarks whose name contains the given text.
+// -count sets the number of elements (or frames) per benchmark, -repeats how many runs the best time is taken from.
+// The rlImGui benchmark opens a hidden window and is skipped when none can be created.
+
+#include "rlImGui.h"
+#include "imgui.h"
+#include "MathBatch.h"
+#include "AabbTree.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <vector>
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define DEFAULT_COUNT 10000
+#define DEFAULT_REPEATS 200
+
+typedef std::chrono::steady_clock Clock;
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct BenchConfig {
+    int count;                  // Elements per run
+    int repeats;                // Runs per measurement, the fastest one is reported
+} BenchConfig;
+
+typedef void (*BenchFunc)(const BenchConfig* config);
+
+typedef struct Benchmark {
+    const char* name;
+    BenchFunc run;
+} Benchmark;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static volatile float Sink = 0.0f;  // Results are folded in here so the optimizer can't drop the work
+
+// Key mapping rlImGui kept in a std::map before the compile-time key table, the rlImGui input baseline
+static const std::pair<KeyboardKey, ImGuiKey> LegacyKeyPairs[] = {
+    { KEY_APOSTROPHE, ImGuiKey_Apostrophe }, { KEY_COMMA, ImGuiKey_Comma }, { KEY_MINUS, ImGuiKey_Minus }, { KEY_PERIOD, ImGuiKey_Period },
+    { KEY_SLASH, ImGuiKey_Slash }, { KEY_ZERO, ImGuiKey_0 }, { KEY_ONE, ImGuiKey_1 }, { KEY_TWO, ImGuiKey_2 },
+    { KEY_THREE, ImGuiKey_3 }, { KEY_FOUR, ImGuiKey_4 }, { KEY_FIVE, ImGuiKey_5 }, { KEY_SIX, ImGuiKey_6 },
+    { KEY_SEVEN, ImGuiKey_7 }, { KEY_EIGHT, ImGuiKey_8 }, { KEY_NINE, ImGuiKey_9 }, { KEY_SEMICOLON, ImGuiKey_Semicolon },
+    { KEY_EQUAL, ImGuiKey_Equal }, { KEY_A, ImGuiKey_A }, { KEY_B, ImGuiKey_B }, { KEY_C, ImGuiKey_C },
+    { KEY_D, ImGuiKey_D }, { KEY_E, ImGuiKey_E }, { KEY_F, ImGuiKey_F }, { KEY_G, ImGuiKey_G },
+    { KEY_H, ImGuiKey_H }, { KEY_I, ImGuiKey_I }, { KEY_J, ImGuiKey_J }, { KEY_K, ImGuiKey_K },
+    { KEY_L, ImGuiKey_L }, { KEY_M, ImGuiKey_M }, { KEY_N, ImGuiKey_N }, { KEY_O, ImGuiKey_O },
+    { KEY_P, ImGuiKey_P }, { KEY_Q, ImGuiKey_Q }, { KEY_R, ImGuiKey_R }, { KEY_S, ImGuiKey_S },
+    { KEY_T, ImGuiKey_T }, { KEY_U, ImGuiKey_U }, { KEY_V, ImGuiKey_V }, { KEY_W, ImGuiKey_W },
+    { KEY_X, ImGuiKey_X }, { KEY_Y, ImGuiKey_Y }, { KEY_Z, ImGuiKey_Z }, { KEY_SPACE, ImGuiKey_Space },
+    { KEY_ESCAPE, ImGuiKey_Escape }, { KEY_ENTER, ImGuiKey_Enter }, { KEY_TAB, ImGuiKey_Tab }, { KEY_BACKSPACE, ImGuiKey_Backspace },
+    { KEY_INSERT, ImGuiKey_Insert }, { KEY_DELETE, ImGuiKey_Delete }, { KEY_RIGHT, ImGuiKey_RightArrow }, { KEY_LEFT, ImGuiKey_LeftArrow },
+    { KEY_DOWN, ImGuiKey_DownArrow }, { KEY_UP, ImGuiKey_UpArrow }, { KEY_PAGE_UP, ImGuiKey_PageUp }, { KEY_PAGE_DOWN, ImGuiKey_PageDown },
+    { KEY_HOME, ImGuiKey_Home }, { KEY_END, ImGuiKey_End }, { KEY_CAPS_LOCK, ImGuiKey_CapsLock }, { KEY_SCROLL_LOCK, ImGuiKey_ScrollLock },
+    { KEY_NUM_LOCK, ImGuiKey_NumLock }, { KEY_PRINT_SCREEN, ImGuiKey_PrintScreen }, { KEY_PAUSE, ImGuiKey_Pause }, { KEY_F1, ImGuiKey_F1 },
+    { KEY_F2, ImGuiKey_F2 }, { KEY_F3, ImGuiKey_F3 }, { KEY_F4, ImGuiKey_F4 }, { KEY_F5, ImGuiKey_F5 },
+    { KEY_F6, ImGuiKey_F6 }, { KEY_F7, ImGuiKey_F7 }, { KEY_F8, ImGuiKey_F8 }, { KEY_F9, ImGuiKey_F9 },
+    { KEY_F10, ImGuiKey_F10 }, { KEY_F11, ImGuiKey_F11 }, { KEY_F12, ImGuiKey_F12 }, { KEY_LEFT_SHIFT, ImGuiKey_LeftShift },
+    { KEY_LEFT_CONTROL, ImGuiKey_LeftCtrl }, { KEY_LEFT_ALT, ImGuiKey_LeftAlt }, { KEY_LEFT_SUPER, ImGuiKey_LeftSuper }, { KEY_RIGHT_SHIFT, ImGuiKey_RightShift },
+    { KEY_RIGHT_CONTROL, ImGuiKey_RightCtrl }, { KEY_RIGHT_ALT, ImGuiKey_RightAlt }, { KEY_RIGHT_SUPER, ImGuiKey_RightSuper }, { KEY_KB_MENU, ImGuiKey_Menu },
+    { KEY_LEFT_BRACKET, ImGuiKey_LeftBracket }, { KEY_BACKSLASH, ImGuiKey_Backslash }, { KEY_RIGHT_BRACKET, ImGuiKey_RightBracket }, { KEY_GRAVE, ImGuiKey_GraveAccent },
+    { KEY_KP_0, ImGuiKey_Keypad0 }, { KEY_KP_1, ImGuiKey_Keypad1 }, { KEY_KP_2, ImGuiKey_Keypad2 }, { KEY_KP_3, ImGuiKey_Keypad3 },
+    { KEY_KP_4, ImGuiKey_Keypad4 }, { KEY_KP_5, ImGuiKey_Keypad5 }, { KEY_KP_6, ImGuiKey_Keypad6 }, { KEY_KP_7, ImGuiKey_Keypad7 },
+    { KEY_KP_8, ImGuiKey_Keypad8 }, { KEY_KP_9, ImGuiKey_Keypad9 }, { KEY_KP_DECIMAL, ImGuiKey_KeypadDecimal }, { KEY_KP_DIVIDE, ImGuiKey_KeypadDivide },
+    { KEY_KP_MULTIPLY, ImGuiKey_KeypadMultiply }, { KEY_KP_SUBTRACT, ImGuiKey_KeypadSubtract }, { KEY_KP_ADD, ImGuiKey_KeypadAdd }, { KEY_KP_ENTER, ImGuiKey_KeypadEnter },
+    { KEY_KP_EQUAL, ImGuiKey_KeypadEqual }
+};
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Run body repeats times and return the fastest run in nanoseconds
+template <typename F>
+static double BestOf(int repeats, F body)
+{
+    double best = 0.0;
+
+    for (int r = 0; r < repeats; r++)
+    {
+        Clock::time_point start = Clock::now();
+        body();
+        double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+        if ((r == 0) || (elapsed < best)) best = elapsed;
+    }
+
+    return best;
+}
+
+// Print one baseline/optimized pair as ns per item and speedup
+static void Report(const char* name, int items, double baselineNs, double optimizedNs)
+{
+    printf("  %-28s %9.2f ns %9.2f ns %7.2fx\n", name, baselineNs / items, optimizedNs / items,
+        (optimizedNs > 0.0) ? baselineNs / optimizedNs : 0.0);
+}
+
+static void ConsumeFloats(const float* values, int count)
+{
+    float sum = 0.0f;
+    for (int i = 0; i < count; i++) sum += values[i];
+    Sink = Sink + sum;
+}
+
+static void ConsumeVectors(const Vector2* values, int count) { ConsumeFloats((const float*)values, count * 2); }
+static void ConsumeVectors(const Vector3* values, int count) { ConsumeFloats((const float*)values, count * 3); }
+
+//----------------------------------------------------------------------------------
+// Benchmarks
+//----------------------------------------------------------------------------------
+
+// MathBatch.h kernels against a loop over the matching Math.h function
+static void BenchMathBatch(const BenchConfig* config)
+{
+    int count = config->count;
+    Rng rng = SeedRng(1);
+
+    std::vector<Vector2> a2(count), b2(count), out2(count);
+    std::vector<Vector3> a3(count), b3(count), out3(count);
+    std::vector<float> outf(count);
+
+    for (int i = 0; i < count; i++)
+    {
+        a2[i] = { Random(&rng, -100.0f, 100.0f), Random(&rng, -100.0f, 100.0f) };
+        b2[i] = { Random(&rng, -100.0f, 100.0f), Random(&rng, -100.0f, 100.0f) };
+        a3[i] = { Random(&rng, -100.0f, 100.0f), Random(&rng, -100.0f, 100.0f), Random(&rng, -100.0f, 100.0f) };
+        b3[i] = { Random(&rng, -100.0f, 100.0f), Random(&rng, -100.0f, 100.0f), Random(&rng, -100.0f, 100.0f) };
+    }
+
+    const Vector2* v2 = a2.data();
+    const Vector2* w2 = b2.data();
+    const Vector3* v3 = a3.data();
+    const Vector3* w3 = b3.data();
+    Vector2* o2 = out2.data();
+    Vector3* o3 = out3.data();
+    float* of = outf.data();
+    double baseline = 0.0, batch = 0.0;
+
+    printf("MathBatch (%d elements)       per-element       batch  speedup\n", count);
+
+    baseline = BestOf(config->repeats, [&] { for (int i = 0; i < count; i++) o2[i] = Add(v2[i], w2[i]); });
+    ConsumeVectors(o2, count);
+    batch = BestOf(config->repeats, [&] { Add(v2, w2, o2, count); });
+    ConsumeVectors(o2, count);
+    Report("Add(Vector2)", count, baseline, batch);
+
+    baseline = BestOf(config->repeats, [&] { for (int i = 0; i < count; i++) o2[i] = Scale(v2[i], 0.5f); });
+    ConsumeVectors(o2, count);
+    batch = BestOf(config->repeats, [&] { Scale(v2, 0.5f, o2, count); });
+    ConsumeVectors(o2, count);
+    Report("Scale(Vector2)", count, baseline, batch);
+
+    baseline = BestOf(config->repeats, [&] { for (int i = 0; i < count; i++) o2[i] = Lerp(v2[i], w2[i], 0.25f); });
+    ConsumeVectors(o2, count);
+    batch = BestOf(config->repeats, [&] { Lerp(v2, w2, 0.25f, o2, count); });
+    ConsumeVectors(o2, count);
+    Report("Lerp(Vector2)", count, baseline, batch);
+
+    baseline = BestOf(config->repeats, [&] { for (int i = 0; i < count; i++) o2[i] = Normalize(v2[i]); });
+    ConsumeVectors(o2, count);
+    batch = BestOf(config->repeats, [&] { Normalize(v2, o2, count); });
+    ConsumeVectors(o2, count);
+    Report("Normalize(Vector2)", count, baseline, batch);
+
+    baseline = BestOf(config->repeats, [&] { for (int i = 0; i < count; i++) o2[i] = Rotate(v2[i], 0.3f); });
+    ConsumeVectors(o2, count);
+    batch = BestOf(config->repeats, [&] { Rotate(v2, 0.3f, o2, count); });
+    ConsumeVectors(o2, count);
+    Report("Rotate(Vector2)", count, baseline, batch);
+
+    baseline = BestOf(config->repeats, [&] { for (int i = 0; i < count; i++) of[i] = Distance(v2[i], w2[i]); });
+    ConsumeFloats(of, count);
+    batch = BestOf(config->repeats, [&] { Distance(v2, w2, of, count); });
+    ConsumeFloats(of, count);
+    Report("Distance(Vector2)", count, baseline, batch);
+
+    baseline = BestOf(config->repeats, [&] { for (int i = 0; i < count; i++) o3[i] = Add(v3[i], w3[i]); });
+    ConsumeVectors(o3, count);
+    batch = BestOf(config->repeats, [&] { Add(v3, w3, o3, count); });
+    ConsumeVectors(o3, count);
+    Report("Add(Vector3)", count, baseline, batch);
+
+    baseline = BestOf(config->repeats, [&] { for (int i = 0; i < count; i++) o3[i] = Normalize(v3[i]); });
+    ConsumeVectors(o3, count);
+    batch = BestOf(config->repeats, [&] { Normalize(v3, o3, count); });
+    ConsumeVectors(o3, count);
+    Report("Normalize(Vector3)", count, baseline, batch);
+
+    baseline = BestOf(config->repeats, [&] { for (int i = 0; i < count; i++) of[i] = Distance(v3[i], w3[i]); });
+    ConsumeFloats(of, count);
+    batch = BestOf(config->repeats, [&] { Distance(v3, w3, of, count); });
+    ConsumeFloats(of, count);
+    Report("Distance(Vector3)", count, baseline, batch);
+}
+
+// Batch Unproject (one matrix inversion) against per-call Unproject (one inversion per point)
+static void BenchUnproject(const BenchConfig* config)
+{
+    int count = config->count;
+    Rng rng = SeedRng(2);
+
+    Matrix projection = Perspective(60.0*DEG2RAD, 16.0/9.0, 0.1, 1000.0);
+    Matrix view = LookAt(Vector3{ 0.0f, 10.0f, 20.0f }, Vector3{ 0.0f, 0.0f, 0.0f }, Vector3{ 0.0f, 1.0f, 0.0f });
+    std::vector<Vector3> source(count), out(count);
+
+    for (int i = 0; i < count; i++) source[i] = { Random(&rng, -1.0f, 1.0f), Random(&rng, -1.0f, 1.0f), Random(&rng, 0.0f, 1.0f) };
+
+    const Vector3* s = source.data();
+    Vector3* o = out.data();
+    double baseline = 0.0, batch = 0.0;
+
+    printf("Unproject (%d points)         per-call          batch  speedup\n", count);
+
+    baseline = BestOf(config->repeats, [&] { for (int i = 0; i < count; i++) o[i] = Unproject(s[i], projection, view); });
+    ConsumeVectors(o, count);
+    batch = BestOf(config->repeats, [&] { Matrix inv = UnprojectMatrix(projection, view); for (int i = 0; i < count; i++) o[i] = Unproject(s[i], inv); });
+    ConsumeVectors(o, count);
+    Report("Unproject(matrix)", count, baseline, batch);
+
+    batch = BestOf(config->repeats, [&] { Unproject(s, projection, view, o, count); });
+    ConsumeVectors(o, count);
+    Report("Unproject(Vector3*)", count, baseline, batch);
+}
+
+// AabbTree FindPairs against testing every pair of proxy boxes
+static void BenchAabbTree(const BenchConfig* config)
+{
+    int count = config->count;
+    int repeats = (config->repeats < 10)? config->repeats : 10;    // The brute-force pass is quadratic
+    Rng rng = SeedRng(3);
+
+    // Scatter small boxes over a square sized for a few overlaps per box
+    float side = sqrtf((float)count) * 16.0f;
+    AabbTree tree = LoadAabbTree(0.0f);
+    std::vector<Aabb> boxes(count);
+
+    for (int i = 0; i < count; i++)
+    {
+        Vector2 center = { Random(&rng, 0.0f, side), Random(&rng, 0.0f, side) };
+        Vector2 extents = { Random(&rng, 1.0f, 4.0f), Random(&rng, 1.0f, 4.0f) };
+        int proxy = CreateProxy(&tree, Aabb{ Subtract(center, extents), Add(center, extents) }, i);
+        boxes[i] = GetProxyBounds(&tree, proxy);
+    }
+
+    int treePairs = 0, brutePairs = 0;
+    double baseline = 0.0, optimized = 0.0;
+
+    printf("AabbTree (%d proxies)         brute-force       tree  speedup\n", count);
+
+    baseline = BestOf(repeats, [&] {
+        brutePairs = 0;
+        for (int i = 0; i < count; i++)
+        {
+            for (int j = i + 1; j < count; j++) if (Overlaps(boxes[i], boxes[j])) brutePairs++;
+        }
+    });
+    optimized = BestOf(repeats, [&] { treePairs = FindPairs(&tree); });
+    Sink = Sink + (float)(treePairs + brutePairs);
+    Report("FindPairs", count, baseline, optimized);
+
+    if (treePairs != brutePairs) printf("  WARNING: FindPairs found %d pairs, brute force %d\n", treePairs, brutePairs);
+    else printf("  %d overlapping pairs, tree height %d\n", treePairs, GetTreeHeight(&tree));
+
+    UnloadAabbTree(tree);
+}
+
+// Input handling of rlImGuiEvents before the key table: a std::map lookup per pressed key
+// and an IsKeyReleased poll for every mapped key, every frame
+static void LegacyEvents(const std::map<KeyboardKey, ImGuiKey>& keyMap)
+{
+    ImGuiIO& io = ImGui::GetIO();
+
+    io.KeyCtrl = IsKeyDown(KEY_RIGHT_CONTROL) || IsKeyDown(KEY_LEFT_CONTROL);
+    io.KeyShift = IsKeyDown(KEY_RIGHT_SHIFT) || IsKeyDown(KEY_LEFT_SHIFT);
+    io.KeyAlt = IsKeyDown(KEY_RIGHT_ALT) || IsKeyDown(KEY_LEFT_ALT);
+    io.KeySuper = IsKeyDown(KEY_RIGHT_SUPER) || IsKeyDown(KEY_LEFT_SUPER);
+
+    for (int key = GetKeyPressed(); key != 0; key = GetKeyPressed())
+    {
+        auto mapped = keyMap.find(KeyboardKey(key));
+        if (mapped != keyMap.end()) io.AddKeyEvent(mapped->second, true);
+    }
+
+    for (const auto& mapped : keyMap)
+    {
+        if (IsKeyReleased(mapped.first)) io.AddKeyEvent(mapped.second, false);
+    }
+
+    for (int character = GetCharPressed(); character != 0; character = GetCharPressed()) io.AddInputCharacter(character);
+}
+
+// rlImGui input capture with the key table against the std::map polling it replaced
+// NOTE: No keys are pressed in the hidden window, so this is the idle per-frame cost
+static void BenchRlImGuiInput(const BenchConfig* config)
+{
+    int frames = config->count;
+    int repeats = (config->repeats < 10)? config->repeats : 10;    // Every frame runs ImGui::NewFrame()
+
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(320, 240, "bench");
+
+    if (!IsWindowReady())
+    {
+        printf("rlImGui input: skipped, no window could be opened\n");
+        return;
+    }
+
+    // One presented frame gives GetFrameTime() a non-zero delta for ImGui
+    rlImGuiSetup(true);
+    BeginDrawing();
+    EndDrawing();
+
+    std::map<KeyboardKey, ImGuiKey> keyMap(std::begin(LegacyKeyPairs), std::end(LegacyKeyPairs));
+    double baseline = 0.0, optimized = 0.0;
+
+    printf("rlImGui input (%d frames)     std::map      key table  speedup\n", frames);
+
+    baseline = BestOf(config->repeats, [&] { for (int i = 0; i < frames; i++) LegacyEvents(keyMap); });
+    optimized = BestOf(config->repeats, [&] { for (int i = 0; i < frames; i++) rlImGuiCaptureInput(); });
+    Report("input events", frames, baseline, optimized);
+
+    // The same with the ImGui frame around it, as rlImGuiBegin() runs it
+    baseline = BestOf(repeats, [&] {
+        for (int i = 0; i < frames; i++)
+        {
+            LegacyEvents(keyMap);
+            ImGui::NewFrame();
+            ImGui::EndFrame();
+        }
+    });
+    optimized = BestOf(repeats, [&] {
+        for (int i = 0; i < frames; i++)
+        {
+            rlImGuiBegin();
+            ImGui::EndFrame();
+        }
+    });
+    Report("rlImGuiBegin", frames, baseline, optimized);
+
+    rlImGuiShutdown();
+    CloseWindow();
+}
+
+//----------------------------------------------------------------------------------
+// Benchmark table
+//----------------------------------------------------------------------------------
+static const Benchmark Benchmarks[] = {
+    { "mathbatch", BenchMathBatch },
+    { "unproject", BenchUnproject },
+    { "aabbtree", BenchAabbTree },
+    { "rlimgui", BenchRlImGuiInput },
+};
+
+//----------------------------------------------------------------------------------
+// Main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    BenchConfig config = { DEFAULT_COUNT, DEFAULT_REPEATS };
+    const char* filter = nullptr;
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool hasValue = (i + 1 < argc);
+
+        if ((strcmp(argv[i], "-filter") == 0) && hasValue) filter = argv[++i];
+        else if ((strcmp(argv[i], "-count") == 0) && hasValue) config.count = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "-repeats") == 0) && hasValue) config.repeats = atoi(argv[++i]);
+        else
+        {
+            fprintf(stderr, "WARNING: Unknown or incomplete option %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    if ((config.count <= 0) || (config.repeats <= 0))
+    {
+        fprintf(stderr, "WARNING: -count and -repeats must be positive\n");
+        return 1;
+    }
+
+    int ran = 0;
+
+    for (const Benchmark& benchmark : Benchmarks)
+    {
+        if ((filter != nullptr) && (strstr(benchmark.name, filter) == nullptr)) continue;
+
+        benchmark.run(&config);
+        printf("\n");
+        ran++;
+    }
+
+    if (ran == 0)
+    {
+        fprintf(stderr, "WARNING: No benchmark matches %s\n", filter);
+        return 1;
+    }
+
+    return 0;
+}
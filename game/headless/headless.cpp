@@ -0,0 +1,227 @@
+// Headless simulation runner: steps the game simulation as fast as possible without a window
+// and reports throughput, tick time percentiles and peak memory.
+//
+// Usage: headless [-ticks N] [-seed N] [-workers N] [-entities N] [-obstacles file] [-assets dir] [-pack file] [-model name]
+//
+// -entities adds N moving ECS entities integrated every tick next to the simulation, to measure entity throughput.
+// -model names a mesh under the assets directory (or in the -pack asset pack), loaded through the asset streamer.
+
+#include "Simulation.h"
+#include "Mesh.h"
+#include "AssetStreamer.h"
+#include "JobSystem.h"
+#include "Ecs.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define DEFAULT_TICKS 100000
+
+typedef std::chrono::steady_clock Clock;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Get the peak resident memory of the process in bytes
+static size_t GetPeakMemory(void)
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters = { 0 };
+    GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+    return counters.PeakWorkingSetSize;
+#else
+    struct rusage usage = { 0 };
+    getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+    return (size_t)usage.ru_maxrss;
+#else
+    return (size_t)usage.ru_maxrss * 1024;
+#endif
+#endif
+}
+
+// Scripted input: wander, sweep the aim around and keep firing
+static SimInput AutoInput(Simulation* sim)
+{
+    SimInput input = { 0 };
+    float t = (float)sim->tick / SIM_TICK_RATE;
+
+    input.move = Direction(t * 0.7f + Random(&sim->rng, -0.5f, 0.5f));
+    input.aim = Direction(t * 3.0f);
+    input.fire = true;
+
+    return input;
+}
+
+// System: move and spin entities by their velocity
+static void IntegrateEntities(void* context, EcsChunk* chunk)
+{
+    float dt = *(const float*)context;
+    TransformComponent* transforms = (TransformComponent*)GetChunkColumn(chunk, COMPONENT_TRANSFORM);
+    const VelocityComponent* velocities = (const VelocityComponent*)GetChunkColumn(chunk, COMPONENT_VELOCITY);
+
+    for (int i = 0; i < chunk->count; i++)
+    {
+        const VelocityComponent* v = &velocities[i];
+        Quaternion spin = { v->angular.x, v->angular.y, v->angular.z, 0.0f };
+
+        transforms[i].translation = Add(transforms[i].translation, Scale(v->linear, dt));
+        transforms[i].rotation = Normalize(Add(transforms[i].rotation, Scale(Multiply(spin, transforms[i].rotation), 0.5f * dt)));
+    }
+}
+
+// Create count entities with random positions and velocities
+static void SpawnEntities(EcsWorld* world, int count, Rng* rng)
+{
+    for (int i = 0; i < count; i++)
+    {
+        Entity entity = CreateEntity(world, COMPONENT_BIT(COMPONENT_TRANSFORM) | COMPONENT_BIT(COMPONENT_VELOCITY) | COMPONENT_BIT(COMPONENT_COLLIDER));
+
+        TransformComponent transform = { { Random(rng, 0.0f, SIM_WORLD_WIDTH), Random(rng, 0.0f, SIM_WORLD_HEIGHT), 0.0f }, QuaternionIdentity() };
+        VelocityComponent velocity = { { Random(rng, -100.0f, 100.0f), Random(rng, -100.0f, 100.0f), 0.0f }, { 0.0f, 0.0f, Random(rng, -PI, PI) } };
+        ColliderComponent collider = { { 4.0f, 4.0f, 4.0f }, COLLIDER_SPHERE, 1 };
+
+        AddComponent(world, entity, COMPONENT_TRANSFORM, &transform);
+        AddComponent(world, entity, COMPONENT_VELOCITY, &velocity);
+        AddComponent(world, entity, COMPONENT_COLLIDER, &collider);
+    }
+
+    ApplyEntityCommands(world);
+}
+
+static double Milliseconds(Clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+//----------------------------------------------------------------------------------
+// Main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    long long ticks = DEFAULT_TICKS;
+    uint64_t seed = 0;
+    int workers = 0;
+    int entities = 0;
+    const char* obstaclesFile = "assets/data/obstacles.txt";
+    const char* assetsDirectory = "assets";
+    const char* packFile = nullptr;
+    const char* modelName = "models/plane.obj";
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool hasValue = (i + 1 < argc);
+
+        if ((strcmp(argv[i], "-ticks") == 0) && hasValue) ticks = atoll(argv[++i]);
+        else if ((strcmp(argv[i], "-seed") == 0) && hasValue) seed = strtoull(argv[++i], nullptr, 10);
+        else if ((strcmp(argv[i], "-workers") == 0) && hasValue) workers = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "-entities") == 0) && hasValue) entities = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "-obstacles") == 0) && hasValue) obstaclesFile = argv[++i];
+        else if ((strcmp(argv[i], "-assets") == 0) && hasValue) assetsDirectory = argv[++i];
+        else if ((strcmp(argv[i], "-pack") == 0) && hasValue) packFile = argv[++i];
+        else if ((strcmp(argv[i], "-model") == 0) && hasValue) modelName = argv[++i];
+        else fprintf(stderr, "WARNING: Unknown or incomplete option %s\n", argv[i]);
+    }
+
+    if (ticks <= 0) ticks = DEFAULT_TICKS;
+
+    InitJobSystem(workers);
+
+    // Load assets
+    Clock::time_point loadStart = Clock::now();
+    AssetPack pack = { 0 };
+    if (packFile != nullptr) pack = LoadAssetPack(packFile);
+
+    // NOTE: No GPU here, the null backend makes streamed assets ready as soon as they are decoded
+    AssetStreamer* streamer = LoadAssetStreamer(assetsDirectory, 0, ASSET_BACKEND_NULL);
+    MountAssetPack(streamer, &pack);
+    AssetHandle planeHandle = RequestAsset(streamer, ASSET_TYPE_MESH, modelName, ASSET_PRIORITY_NORMAL);
+
+    Simulation sim = LoadSimulation(obstaclesFile, seed);
+    EcsWorld* world = LoadEcsWorld();
+    EcsQuery moving = LoadQuery(COMPONENT_BIT(COMPONENT_TRANSFORM) | COMPONENT_BIT(COMPONENT_VELOCITY), 0);
+    Rng entityRng = SeedRng(seed ^ 0x9E3779B97F4A7C15ull);     // Separate stream, the simulation stays the same with or without entities
+    SpawnEntities(world, entities, &entityRng);
+
+    WaitForAsset(streamer, planeHandle);
+    MeshData plane = { 0 };
+    if (GetAsset(streamer, planeHandle) != nullptr) plane = *(const MeshData*)GetAsset(streamer, planeHandle);
+    double loadTime = Milliseconds(Clock::now() - loadStart);
+
+    printf("Loaded %i obstacles, %i model vertices (%i indices) in %.2f ms\n", sim.obstacles.count, plane.vertexCount, plane.indexCount, loadTime);
+
+    // A run without its level, model or pack measures the wrong thing, the loaders already reported why
+    bool loaded = (sim.obstacles.count > 0) && (plane.vertexCount > 0) && ((packFile == nullptr) || (pack.entryCount > 0));
+    if (!loaded)
+    {
+        UnloadQuery(moving);
+        UnloadEcsWorld(world);
+        UnloadSimulation(sim);
+        UnloadAssetStreamer(streamer);
+        UnloadAssetPack(pack);
+        ShutdownJobSystem();
+
+        return 1;
+    }
+    printf("Workers:     %i\n", GetWorkerCount());
+    printf("Entities:    %i\n", GetEntityCount(world));
+
+    // Step
+    std::vector<float> tickTimes((size_t)ticks);
+    float dt = 1.0f / SIM_TICK_RATE;
+    Clock::time_point runStart = Clock::now();
+
+    for (long long i = 0; i < ticks; i++)
+    {
+        SimInput input = AutoInput(&sim);
+
+        Clock::time_point tickStart = Clock::now();
+        StepSimulation(&sim, input, dt);
+
+        JobCounter integrated;
+        ParallelForEachChunk(world, &moving, IntegrateEntities, &dt, &integrated);
+        WaitForCounter(&integrated);
+        ApplyEntityCommands(world);
+
+        tickTimes[(size_t)i] = (float)Milliseconds(Clock::now() - tickStart);
+    }
+
+    double runTime = Milliseconds(Clock::now() - runStart);
+
+    // Report
+    std::sort(tickTimes.begin(), tickTimes.end());
+    float p50 = tickTimes[(size_t)(ticks * 50 / 100)];
+    float p99 = tickTimes[(size_t)std::min(ticks - 1, ticks * 99 / 100)];
+
+    printf("Ticks:       %lld (%.1f simulated seconds)\n", ticks, ticks * (double)dt);
+    printf("Throughput:  %.0f ticks/sec (%.1fx real time)\n", ticks / (runTime / 1000.0), (ticks * (double)dt) / (runTime / 1000.0));
+    printf("Tick time:   p50 %.4f ms, p99 %.4f ms, max %.4f ms\n", p50, p99, tickTimes.back());
+    printf("Peak memory: %.2f MB\n", GetPeakMemory() / (1024.0 * 1024.0));
+    printf("State:       bullets %i, hits %i\n", sim.bullets.count, sim.hits);
+
+    UnloadQuery(moving);
+    UnloadEcsWorld(world);
+    UnloadSimulation(sim);
+    UnloadAssetStreamer(streamer);
+    UnloadAssetPack(pack);
+    ShutdownJobSystem();
+
+    return 0;
+}
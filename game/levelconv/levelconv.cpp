@@ -0,0 +1,150 @@
+// Level converter: turns a text obstacles file into the binary level format (see Obstacles.h),
+// then reloads the binary file to verify it matches the source and prints load timings for both.
+//
+// Usage: levelconv [-input file] [-output file] [-sort]
+//
+// -sort reorders the rectangles along a Z-order curve so spatial index builds walk memory mostly in order,
+// obstacle ids (and the order of collision responses) change, so it is off by default.
+
+#include "Obstacles.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+static double Milliseconds(Clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+// Spread the low 16 bits of v to the even bits
+static uint32_t SpreadBits(uint32_t v)
+{
+    v &= 0xFFFF;
+    v = (v | (v << 8)) & 0x00FF00FF;
+    v = (v | (v << 4)) & 0x0F0F0F0F;
+    v = (v | (v << 2)) & 0x33333333;
+    v = (v | (v << 1)) & 0x55555555;
+
+    return v;
+}
+
+// Copy obstacles in Z-order of their top-left corner within the level bounds (heap arrays, see UnloadObstacles)
+static Obstacles SortObstacles(const Obstacles* obstacles)
+{
+    int count = obstacles->count;
+    Vector2 extent = Subtract(obstacles->bounds.max, obstacles->bounds.min);
+    float scaleX = (extent.x > 0.0f)? 65535.0f / extent.x : 0.0f;
+    float scaleY = (extent.y > 0.0f)? 65535.0f / extent.y : 0.0f;
+
+    std::vector<uint64_t> keys((size_t)count);
+    for (int i = 0; i < count; i++)
+    {
+        uint32_t qx = (uint32_t)((obstacles->x[i] - obstacles->bounds.min.x) * scaleX);
+        uint32_t qy = (uint32_t)((obstacles->y[i] - obstacles->bounds.min.y) * scaleY);
+        keys[(size_t)i] = ((uint64_t)(SpreadBits(qx) | (SpreadBits(qy) << 1)) << 32) | (uint32_t)i;
+    }
+
+    std::sort(keys.begin(), keys.end());
+
+    float* data = (float*)malloc((size_t)count * 4 * sizeof(float) + ((obstacles->tags != nullptr)? (size_t)count * sizeof(uint32_t) : 0));
+    float* x = data;
+    float* y = x + count;
+    float* w = y + count;
+    float* h = w + count;
+    uint32_t* tags = (obstacles->tags != nullptr)? (uint32_t*)(h + count) : nullptr;
+
+    for (int i = 0; i < count; i++)
+    {
+        int source = (int)(keys[(size_t)i] & 0xFFFFFFFF);
+        x[i] = obstacles->x[source];
+        y[i] = obstacles->y[source];
+        w[i] = obstacles->w[source];
+        h[i] = obstacles->h[source];
+        if (tags != nullptr) tags[i] = obstacles->tags[source];
+    }
+
+    Obstacles sorted = *obstacles;
+    sorted.x = x;
+    sorted.y = y;
+    sorted.w = w;
+    sorted.h = h;
+    sorted.tags = tags;
+    sorted.file = MappedFile{ 0 };
+
+    return sorted;
+}
+
+// Check if two obstacle sets hold the same rectangles and tags
+static bool SameObstacles(const Obstacles* a, const Obstacles* b)
+{
+    if ((a->count != b->count) || ((a->tags == nullptr) != (b->tags == nullptr))) return false;
+
+    size_t size = (size_t)a->count * sizeof(float);
+    if ((size > 0) && ((memcmp(a->x, b->x, size) != 0) || (memcmp(a->y, b->y, size) != 0) ||
+        (memcmp(a->w, b->w, size) != 0) || (memcmp(a->h, b->h, size) != 0))) return false;
+
+    return (a->tags == nullptr) || (size == 0) || (memcmp(a->tags, b->tags, size) == 0);
+}
+
+//----------------------------------------------------------------------------------
+// Main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    const char* inputFile = "assets/data/obstacles.txt";
+    const char* outputFile = "assets/data/obstacles.bin";
+    bool sort = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-sort") == 0) sort = true;
+        else if ((strcmp(argv[i], "-input") == 0) && (i + 1 < argc)) inputFile = argv[++i];
+        else if ((strcmp(argv[i], "-output") == 0) && (i + 1 < argc)) outputFile = argv[++i];
+        else fprintf(stderr, "WARNING: Unknown option %s\n", argv[i]);
+    }
+
+    Clock::time_point start = Clock::now();
+    Obstacles source = LoadObstacles(inputFile);
+    double textTime = Milliseconds(Clock::now() - start);
+
+    if (sort && (source.count > 0))
+    {
+        Obstacles sorted = SortObstacles(&source);
+        UnloadObstacles(source);
+        source = sorted;
+    }
+
+    if ((source.count == 0) || !ExportObstacles(&source, outputFile))
+    {
+        UnloadObstacles(source);
+        return 1;
+    }
+
+    // Verify
+    start = Clock::now();
+    Obstacles level = LoadObstacles(outputFile);
+    double binaryTime = Milliseconds(Clock::now() - start);
+
+    bool same = SameObstacles(&source, &level);
+    if (!same) fprintf(stderr, "WARNING: LEVEL: [%s] Binary level doesn't match its source\n", outputFile);
+
+    printf("%i obstacles%s, bounds (%.1f, %.1f) - (%.1f, %.1f)\n", level.count, (level.tags != nullptr)? " with tags" : "",
+        level.bounds.min.x, level.bounds.min.y, level.bounds.max.x, level.bounds.max.y);
+    printf("Source load: %.3f ms (%s)\n", textTime, inputFile);
+    printf("Binary load: %.3f ms (%s, %zu bytes)\n", binaryTime, outputFile, level.file.size);
+
+    UnloadObstacles(level);
+    UnloadObstacles(source);
+
+    return same? 0 : 1;
+}
@@ -0,0 +1,99 @@
+// Asset packer: writes every file under a directory into one asset pack (see AssetPack.h),
+// then reloads the pack to verify each entry and prints the table of contents.
+//
+// Usage: packer [-input dir] [-output file] [-store]
+//
+// -store disables LZ4 compression, by default each entry is compressed when that saves enough.
+
+#include "AssetPack.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------------
+// Main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    const char* inputDir = "assets";
+    const char* outputFile = "assets.pack";
+    bool compress = true;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-store") == 0) compress = false;
+        else if ((strcmp(argv[i], "-input") == 0) && (i + 1 < argc)) inputDir = argv[++i];
+        else if ((strcmp(argv[i], "-output") == 0) && (i + 1 < argc)) outputFile = argv[++i];
+        else fprintf(stderr, "WARNING: Unknown option %s\n", argv[i]);
+    }
+
+    // Collect files, sorted so the pack layout doesn't depend on directory enumeration order
+    std::vector<std::string> names, paths;
+    std::error_code error;
+    for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(inputDir, error))
+    {
+        if (!item.is_regular_file()) continue;
+
+        std::string name = std::filesystem::relative(item.path(), inputDir).generic_string();
+        if (name.find(".meshcache") != std::string::npos) continue;      // Local caches, rebuilt on demand
+
+        names.push_back(name);
+    }
+
+    if (error)
+    {
+        fprintf(stderr, "WARNING: FILEIO: [%s] Failed to list directory\n", inputDir);
+        return 1;
+    }
+
+    std::sort(names.begin(), names.end());
+
+    std::vector<PackSource> sources;
+    for (const std::string& name : names) paths.push_back((std::filesystem::path(inputDir) / name).string());
+    for (size_t i = 0; i < names.size(); i++) sources.push_back(PackSource{ names[i].c_str(), paths[i].c_str(), compress });
+
+    if (!ExportAssetPack(outputFile, sources.data(), (int)sources.size())) return 1;
+
+    // Verify
+    AssetPack pack = LoadAssetPack(outputFile);
+    if (pack.entryCount != (int)sources.size()) return 1;
+
+    int failures = 0;
+    uint64_t totalSize = 0, totalStored = 0;
+    printf("%-40s %12s %12s  %s\n", "Entry", "Size", "Stored", "Compression");
+
+    for (size_t i = 0; i < sources.size(); i++)
+    {
+        int index = FindPackEntry(&pack, sources[i].name);
+        if (index < 0)
+        {
+            fprintf(stderr, "WARNING: PACK: [%s] Entry missing after packing\n", sources[i].name);
+            failures++;
+            continue;
+        }
+
+        const PackEntry* entry = &pack.entries[index];
+        std::vector<unsigned char> data((size_t)entry->size + 1);
+        if (!ReadPackEntry(&pack, index, data.data(), data.size()))
+        {
+            fprintf(stderr, "WARNING: PACK: [%s] Entry failed to decode\n", sources[i].name);
+            failures++;
+        }
+
+        totalSize += entry->size;
+        totalStored += entry->storedSize;
+        printf("%-40s %12llu %12llu  %s\n", sources[i].name, (unsigned long long)entry->size, (unsigned long long)entry->storedSize,
+            (entry->compression == PACK_COMPRESSION_LZ4)? "lz4" : "none");
+    }
+
+    printf("%i entries, %llu bytes stored in %llu (pack %zu bytes)\n", pack.entryCount, (unsigned long long)totalSize,
+        (unsigned long long)totalStored, pack.file.size);
+
+    UnloadAssetPack(pack);
+
+    return (failures == 0)? 0 : 1;
+}
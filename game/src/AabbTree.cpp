@@ -0,0 +1,528 @@
+#include "AabbTree.h"
+#include <cstdlib>
+#include <cstring>
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define AABB_TREE_STACK_SIZE 256        // Traversal stack entries kept on the C stack, balanced trees stay far below this
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Traversal stack type, starts in a fixed buffer and moves to the heap if a degenerate tree needs more
+template <typename T>
+struct TraversalStack {
+    T buffer[AABB_TREE_STACK_SIZE];
+    T* items;
+    int count;
+    int capacity;
+};
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+template <typename T>
+static void InitStack(TraversalStack<T>* stack)
+{
+    stack->items = stack->buffer;
+    stack->count = 0;
+    stack->capacity = AABB_TREE_STACK_SIZE;
+}
+
+template <typename T>
+static void FreeStack(TraversalStack<T>* stack)
+{
+    if (stack->items != stack->buffer) free(stack->items);
+}
+
+template <typename T>
+static void PushStack(TraversalStack<T>* stack, T value)
+{
+    if (stack->count == stack->capacity)
+    {
+        int capacity = stack->capacity * 2;
+        T* items = (T*)malloc(capacity * sizeof(T));
+        memcpy(items, stack->items, stack->count * sizeof(T));
+        FreeStack(stack);
+
+        stack->items = items;
+        stack->capacity = capacity;
+    }
+
+    stack->items[stack->count++] = value;
+}
+
+template <typename T>
+static T PopStack(TraversalStack<T>* stack)
+{
+    return stack->items[--stack->count];
+}
+
+static bool IsLeaf(const AabbTreeNode* node)
+{
+    return node->child1 == AABB_TREE_NULL;
+}
+
+static int AllocateNode(AabbTree* tree)
+{
+    if (tree->freeList == AABB_TREE_NULL)
+    {
+        int capacity = (tree->nodeCapacity == 0)? 16 : tree->nodeCapacity * 2;
+        tree->nodes = (AabbTreeNode*)realloc(tree->nodes, capacity * sizeof(AabbTreeNode));
+
+        // Thread the new nodes into the free list
+        for (int i = tree->nodeCapacity; i < capacity; i++)
+        {
+            tree->nodes[i].parent = (i + 1 < capacity)? i + 1 : AABB_TREE_NULL;
+            tree->nodes[i].height = -1;
+        }
+
+        tree->freeList = tree->nodeCapacity;
+        tree->nodeCapacity = capacity;
+    }
+
+    int index = tree->freeList;
+    AabbTreeNode* node = &tree->nodes[index];
+    tree->freeList = node->parent;
+
+    node->parent = AABB_TREE_NULL;
+    node->child1 = AABB_TREE_NULL;
+    node->child2 = AABB_TREE_NULL;
+    node->height = 0;
+    node->userData = -1;
+    tree->nodeCount++;
+
+    return index;
+}
+
+static void FreeNode(AabbTree* tree, int index)
+{
+    tree->nodes[index].parent = tree->freeList;
+    tree->nodes[index].height = -1;
+    tree->freeList = index;
+    tree->nodeCount--;
+}
+
+// Recompute the box and height of an internal node from its children
+static void Refit(AabbTree* tree, int index)
+{
+    AabbTreeNode* node = &tree->nodes[index];
+    const AabbTreeNode* child1 = &tree->nodes[node->child1];
+    const AabbTreeNode* child2 = &tree->nodes[node->child2];
+
+    node->bounds = Merge(child1->bounds, child2->bounds);
+    node->height = 1 + ((child1->height > child2->height)? child1->height : child2->height);
+}
+
+// Point the parent of oldChild (or the root) at newChild
+static void ReplaceChild(AabbTree* tree, int parent, int oldChild, int newChild)
+{
+    if (parent == AABB_TREE_NULL) tree->root = newChild;
+    else if (tree->nodes[parent].child1 == oldChild) tree->nodes[parent].child1 = newChild;
+    else tree->nodes[parent].child2 = newChild;
+}
+
+// Rotate the taller grandchild up if the subtree at iA is unbalanced, returns the new subtree root
+static int Balance(AabbTree* tree, int iA)
+{
+    AabbTreeNode* A = &tree->nodes[iA];
+    if (IsLeaf(A) || (A->height < 2)) return iA;
+
+    int iB = A->child1;
+    int iC = A->child2;
+    AabbTreeNode* B = &tree->nodes[iB];
+    AabbTreeNode* C = &tree->nodes[iC];
+    int balance = C->height - B->height;
+
+    // Rotate C up
+    if (balance > 1)
+    {
+        int iF = C->child1;
+        int iG = C->child2;
+        AabbTreeNode* F = &tree->nodes[iF];
+        AabbTreeNode* G = &tree->nodes[iG];
+
+        C->child1 = iA;
+        C->parent = A->parent;
+        A->parent = iC;
+        ReplaceChild(tree, C->parent, iA, iC);
+
+        // Keep the taller of F and G under C, hand the other one to A
+        if (F->height > G->height)
+        {
+            C->child2 = iF;
+            A->child2 = iG;
+            G->parent = iA;
+        }
+        else
+        {
+            C->child2 = iG;
+            A->child2 = iF;
+            F->parent = iA;
+        }
+
+        Refit(tree, iA);
+        Refit(tree, iC);
+
+        return iC;
+    }
+
+    // Rotate B up
+    if (balance < -1)
+    {
+        int iD = B->child1;
+        int iE = B->child2;
+        AabbTreeNode* D = &tree->nodes[iD];
+        AabbTreeNode* E = &tree->nodes[iE];
+
+        B->child1 = iA;
+        B->parent = A->parent;
+        A->parent = iB;
+        ReplaceChild(tree, B->parent, iA, iB);
+
+        if (D->height > E->height)
+        {
+            B->child2 = iD;
+            A->child1 = iE;
+            E->parent = iA;
+        }
+        else
+        {
+            B->child2 = iE;
+            A->child1 = iD;
+            D->parent = iA;
+        }
+
+        Refit(tree, iA);
+        Refit(tree, iB);
+
+        return iB;
+    }
+
+    return iA;
+}
+
+// Refit and rebalance every node from index up to the root
+static void FixUpwards(AabbTree* tree, int index)
+{
+    while (index != AABB_TREE_NULL)
+    {
+        index = Balance(tree, index);
+        Refit(tree, index);
+        index = tree->nodes[index].parent;
+    }
+}
+
+static void InsertLeaf(AabbTree* tree, int leaf)
+{
+    if (tree->root == AABB_TREE_NULL)
+    {
+        tree->root = leaf;
+        tree->nodes[leaf].parent = AABB_TREE_NULL;
+        return;
+    }
+
+    // Descend towards the sibling that grows the total perimeter the least
+    Aabb leafBounds = tree->nodes[leaf].bounds;
+    int index = tree->root;
+
+    while (!IsLeaf(&tree->nodes[index]))
+    {
+        const AabbTreeNode* node = &tree->nodes[index];
+        float perimeter = Perimeter(node->bounds);
+        float combinedPerimeter = Perimeter(Merge(node->bounds, leafBounds));
+
+        // Cost of pairing with this node, and the growth every ancestor pays if we keep descending
+        float cost = 2.0f * combinedPerimeter;
+        float inheritanceCost = 2.0f * (combinedPerimeter - perimeter);
+
+        float childCost[2] = { 0 };
+        int children[2] = { node->child1, node->child2 };
+
+        for (int i = 0; i < 2; i++)
+        {
+            const AabbTreeNode* child = &tree->nodes[children[i]];
+            float merged = Perimeter(Merge(child->bounds, leafBounds));
+            childCost[i] = (IsLeaf(child)? merged : merged - Perimeter(child->bounds)) + inheritanceCost;
+        }
+
+        if ((cost < childCost[0]) && (cost < childCost[1])) break;
+
+        index = (childCost[0] < childCost[1])? children[0] : children[1];
+    }
+
+    // Splice a new parent above the sibling
+    int sibling = index;
+    int oldParent = tree->nodes[sibling].parent;
+    int newParent = AllocateNode(tree);
+
+    AabbTreeNode* parent = &tree->nodes[newParent];
+    parent->parent = oldParent;
+    parent->child1 = sibling;
+    parent->child2 = leaf;
+    parent->bounds = Merge(leafBounds, tree->nodes[sibling].bounds);
+    parent->height = tree->nodes[sibling].height + 1;
+
+    ReplaceChild(tree, oldParent, sibling, newParent);
+    tree->nodes[sibling].parent = newParent;
+    tree->nodes[leaf].parent = newParent;
+
+    FixUpwards(tree, oldParent);
+}
+
+static void RemoveLeaf(AabbTree* tree, int leaf)
+{
+    if (leaf == tree->root)
+    {
+        tree->root = AABB_TREE_NULL;
+        return;
+    }
+
+    int parent = tree->nodes[leaf].parent;
+    int grandParent = tree->nodes[parent].parent;
+    int sibling = (tree->nodes[parent].child1 == leaf)? tree->nodes[parent].child2 : tree->nodes[parent].child1;
+
+    // The sibling takes the place of the parent
+    ReplaceChild(tree, grandParent, parent, sibling);
+    tree->nodes[sibling].parent = grandParent;
+    FreeNode(tree, parent);
+
+    FixUpwards(tree, grandParent);
+}
+
+static void PushPair(AabbTree* tree, int a, int b)
+{
+    if (tree->pairCount == tree->pairCapacity)
+    {
+        tree->pairCapacity = (tree->pairCapacity == 0)? 64 : tree->pairCapacity * 2;
+        tree->pairs = (AabbTreePair*)realloc(tree->pairs, tree->pairCapacity * sizeof(AabbTreePair));
+    }
+
+    AabbTreePair pair = { (a < b)? a : b, (a < b)? b : a };
+    tree->pairs[tree->pairCount++] = pair;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+AabbTree LoadAabbTree(float margin)
+{
+    AabbTree tree = { 0 };
+    tree.root = AABB_TREE_NULL;
+    tree.freeList = AABB_TREE_NULL;
+    tree.margin = (margin > 0.0f)? margin : AABB_TREE_MARGIN;
+
+    return tree;
+}
+
+void UnloadAabbTree(AabbTree tree)
+{
+    free(tree.nodes);
+    free(tree.pairs);
+}
+
+int CreateProxy(AabbTree* tree, Aabb bounds, int userData)
+{
+    int proxy = AllocateNode(tree);
+
+    tree->nodes[proxy].bounds = Inflate(bounds, tree->margin);
+    tree->nodes[proxy].userData = userData;
+    tree->proxyCount++;
+
+    InsertLeaf(tree, proxy);
+
+    return proxy;
+}
+
+void DestroyProxy(AabbTree* tree, int proxy)
+{
+    RemoveLeaf(tree, proxy);
+    FreeNode(tree, proxy);
+    tree->proxyCount--;
+}
+
+bool MoveProxy(AabbTree* tree, int proxy, Aabb bounds, Vector2 displacement)
+{
+    // Predict the motion by stretching the fat box along the displacement
+    Aabb fat = Inflate(bounds, tree->margin);
+    Vector2 d = Scale(displacement, AABB_TREE_DISPLACEMENT);
+
+    if (d.x < 0.0f) fat.min.x += d.x;
+    else fat.max.x += d.x;
+    if (d.y < 0.0f) fat.min.y += d.y;
+    else fat.max.y += d.y;
+
+    Aabb current = tree->nodes[proxy].bounds;
+    if (Contains(current, bounds))
+    {
+        // Still inside the fat box, unless that box has grown far too large for the current motion
+        Aabb huge = Inflate(fat, 4.0f * tree->margin);
+        if (Contains(huge, current)) return false;
+    }
+
+    RemoveLeaf(tree, proxy);
+    tree->nodes[proxy].bounds = fat;
+    InsertLeaf(tree, proxy);
+
+    return true;
+}
+
+int GetProxyUserData(const AabbTree* tree, int proxy)
+{
+    return tree->nodes[proxy].userData;
+}
+
+Aabb GetProxyBounds(const AabbTree* tree, int proxy)
+{
+    return tree->nodes[proxy].bounds;
+}
+
+int GetTreeHeight(const AabbTree* tree)
+{
+    return (tree->root == AABB_TREE_NULL)? 0 : tree->nodes[tree->root].height;
+}
+
+int FindPairs(AabbTree* tree)
+{
+    tree->pairCount = 0;
+
+    // Every overlapping leaf pair has exactly one lowest common ancestor, so crossing the two
+    // children of each internal node reports each pair once without a deduplication pass
+    // Stack entries are node index pairs still to be crossed
+    TraversalStack<AabbTreePair> stack;
+    InitStack(&stack);
+
+    for (int i = 0; i < tree->nodeCapacity; i++)
+    {
+        const AabbTreeNode* node = &tree->nodes[i];
+        if (node->height <= 0) continue;
+
+        PushStack(&stack, AabbTreePair{ node->child1, node->child2 });
+
+        while (stack.count > 0)
+        {
+            AabbTreePair nodes = PopStack(&stack);
+            const AabbTreeNode* a = &tree->nodes[nodes.a];
+            const AabbTreeNode* b = &tree->nodes[nodes.b];
+            if (!Overlaps(a->bounds, b->bounds)) continue;
+
+            bool leafA = IsLeaf(a);
+            bool leafB = IsLeaf(b);
+
+            if (leafA && leafB)
+            {
+                PushPair(tree, a->userData, b->userData);
+                continue;
+            }
+
+            // Descend into the larger internal node
+            if (leafB || (!leafA && (Perimeter(a->bounds) > Perimeter(b->bounds))))
+            {
+                PushStack(&stack, AabbTreePair{ a->child1, nodes.b });
+                PushStack(&stack, AabbTreePair{ a->child2, nodes.b });
+            }
+            else
+            {
+                PushStack(&stack, AabbTreePair{ nodes.a, b->child1 });
+                PushStack(&stack, AabbTreePair{ nodes.a, b->child2 });
+            }
+        }
+    }
+
+    FreeStack(&stack);
+
+    return tree->pairCount;
+}
+
+// Depth-first traversal shared by the region queries, test(box) decides which subtrees to visit
+template <typename Test>
+static int Query(const AabbTree* tree, Test test, int* out, int maxOut)
+{
+    int count = 0;
+    if ((tree->root == AABB_TREE_NULL) || (maxOut <= 0)) return count;
+
+    TraversalStack<int> stack;
+    InitStack(&stack);
+    PushStack(&stack, tree->root);
+
+    while (stack.count > 0)
+    {
+        const AabbTreeNode* node = &tree->nodes[PopStack(&stack)];
+        if (!test(node->bounds)) continue;
+
+        if (IsLeaf(node))
+        {
+            out[count++] = node->userData;
+            if (count == maxOut) break;
+        }
+        else
+        {
+            PushStack(&stack, node->child1);
+            PushStack(&stack, node->child2);
+        }
+    }
+
+    FreeStack(&stack);
+
+    return count;
+}
+
+int QueryPoint(const AabbTree* tree, Vector2 point, int* out, int maxOut)
+{
+    return Query(tree, [point](Aabb box) { return Contains(box, point); }, out, maxOut);
+}
+
+int QueryCircle(const AabbTree* tree, Vector2 center, float radius, int* out, int maxOut)
+{
+    float radiusSqr = radius * radius;
+    return Query(tree, [center, radiusSqr](Aabb box) { return DistanceSqr(box, center) <= radiusSqr; }, out, maxOut);
+}
+
+int QueryRect(const AabbTree* tree, Aabb rect, int* out, int maxOut)
+{
+    return Query(tree, [rect](Aabb box) { return Overlaps(box, rect); }, out, maxOut);
+}
+
+int QuerySegment(const AabbTree* tree, Vector2 start, Vector2 end, float radius, int* out, int maxOut)
+{
+    return Query(tree, [start, end, radius](Aabb box) { return SegmentOverlaps(box, start, end, radius); }, out, maxOut);
+}
+
+void Raycast(const AabbTree* tree, Vector2 start, Vector2 end, AabbTreeRayCallback callback, void* context)
+{
+    if (tree->root == AABB_TREE_NULL) return;
+
+    float maxFraction = 1.0f;
+    Vector2 delta = Subtract(end, start);
+
+    TraversalStack<int> stack;
+    InitStack(&stack);
+    PushStack(&stack, tree->root);
+
+    while (stack.count > 0)
+    {
+        const AabbTreeNode* node = &tree->nodes[PopStack(&stack)];
+
+        // Test against the ray clipped to the closest hit so far
+        Vector2 clippedEnd = Add(start, Scale(delta, maxFraction));
+        if (!SegmentOverlaps(node->bounds, start, clippedEnd)) continue;
+
+        if (IsLeaf(node))
+        {
+            float fraction = callback(context, node->userData, start, end, maxFraction);
+            if (fraction <= 0.0f) break;
+            if (fraction < maxFraction) maxFraction = fraction;
+        }
+        else
+        {
+            PushStack(&stack, node->child1);
+            PushStack(&stack, node->child2);
+        }
+    }
+
+    FreeStack(&stack);
+}
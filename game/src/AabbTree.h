@@ -0,0 +1,100 @@
+#pragma once
+#include "Math.h"
+
+// Dynamic bounding volume tree for moving entities (planes, projectiles).
+// Leaves hold fattened boxes, so an entity moving inside its fat box costs nothing to update.
+// Insertion picks the sibling with the cheapest perimeter growth and the path back to the root
+// is rebalanced with AVL-style rotations, keeping queries logarithmic as entities come and go.
+// Proxy ids are node indices: stable for the lifetime of the proxy and reused after DestroyProxy.
+// NOTE: Queries don't modify the tree and are safe to run from several threads at once
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define AABB_TREE_NULL -1               // Null node index
+#define AABB_TREE_MARGIN 0.1f           // Default fat box margin (world units)
+#define AABB_TREE_DISPLACEMENT 4.0f     // Fat boxes are stretched this many displacements along the motion
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Tree node type
+typedef struct AabbTreeNode {
+    Aabb bounds;        // Fat box for leaves, union of children otherwise
+    int parent;         // Parent node, or next free node when unused
+    int child1;
+    int child2;
+    int height;         // 0 for leaves, -1 for free nodes
+    int userData;
+} AabbTreeNode;
+
+// Overlapping leaf pair type (user data of both leaves)
+typedef struct AabbTreePair {
+    int a;
+    int b;
+} AabbTreePair;
+
+// Dynamic tree type
+typedef struct AabbTree {
+    AabbTreeNode* nodes;
+    int nodeCount;
+    int nodeCapacity;
+    int root;
+    int freeList;
+    int proxyCount;
+    float margin;
+    AabbTreePair* pairs;    // Result of the last FindPairs call
+    int pairCount;
+    int pairCapacity;
+} AabbTree;
+
+// Ray callback, receives the user data of a leaf whose box the ray crosses and returns the new max fraction:
+// 0 stops the cast, the hit fraction clips the ray, maxFraction keeps going unchanged
+typedef float (*AabbTreeRayCallback)(void* context, int userData, Vector2 start, Vector2 end, float maxFraction);
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+// Create an empty tree, margin <= 0 uses AABB_TREE_MARGIN
+AabbTree LoadAabbTree(float margin);
+
+// Free tree data
+void UnloadAabbTree(AabbTree tree);
+
+// Insert a leaf for bounds and return its proxy id
+int CreateProxy(AabbTree* tree, Aabb bounds, int userData);
+
+// Remove a leaf
+void DestroyProxy(AabbTree* tree, int proxy);
+
+// Update a leaf after its entity moved by displacement, returns true if the leaf had to be reinserted
+bool MoveProxy(AabbTree* tree, int proxy, Aabb bounds, Vector2 displacement);
+
+// Get the user data of a leaf
+int GetProxyUserData(const AabbTree* tree, int proxy);
+
+// Get the fat box of a leaf
+Aabb GetProxyBounds(const AabbTree* tree, int proxy);
+
+// Get the height of the tree (0 for a single leaf)
+int GetTreeHeight(const AabbTree* tree);
+
+// Find every pair of leaves with overlapping fat boxes, results are stored in tree->pairs
+int FindPairs(AabbTree* tree);
+
+// Find leaves whose fat box contains a point, writes user data into out
+int QueryPoint(const AabbTree* tree, Vector2 point, int* out, int maxOut);
+
+// Find leaves whose fat box overlaps a circle, writes user data into out
+int QueryCircle(const AabbTree* tree, Vector2 center, float radius, int* out, int maxOut);
+
+// Find leaves whose fat box overlaps a rectangle, writes user data into out
+int QueryRect(const AabbTree* tree, Aabb rect, int* out, int maxOut);
+
+// Find leaves whose fat box is touched by the segment, thickened by radius, writes user data into out
+int QuerySegment(const AabbTree* tree, Vector2 start, Vector2 end, float radius, int* out, int maxOut);
+
+// Cast a ray through the tree, calling back for every leaf crossed within the current max fraction
+void Raycast(const AabbTree* tree, Vector2 start, Vector2 end, AabbTreeRayCallback callback, void* context);
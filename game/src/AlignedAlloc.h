@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdlib>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+// Aligned heap allocation shared by the SoA streams and the frame arena.
+// NOTE: Memory from AlignedAlloc must be released with AlignedFree (plain free is wrong on Windows)
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Allocate size bytes aligned to alignment (must be a power of two)
+inline void* AlignedAlloc(size_t size, size_t alignment)
+{
+#if defined(_WIN32)
+    return _aligned_malloc(size, alignment);
+#else
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, alignment, size) != 0) return nullptr;
+    return ptr;
+#endif
+}
+
+// Free memory returned by AlignedAlloc
+inline void AlignedFree(void* ptr)
+{
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
@@ -0,0 +1,245 @@
+#include "AssetPack.h"
+#include "Lz4.h"
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define PACK_MAGIC 0x4B434150u          // "PACK"
+#define PACK_VERSION 1
+#define PACK_MIN_SAVING 8               // Compressed entries must be at least 1/PACK_MIN_SAVING smaller than the original
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Pack file header
+typedef struct PackHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t namesSize;
+    uint64_t tocOffset;                 // Entry table, the name table follows it
+} PackHeader;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+static uint64_t AlignPackOffset(uint64_t offset)
+{
+    return (offset + PACK_ALIGNMENT - 1) & ~(uint64_t)(PACK_ALIGNMENT - 1);
+}
+
+// Write zero bytes up to the next PACK_ALIGNMENT boundary
+static bool WritePadding(FILE* file, uint64_t* offset)
+{
+    static const unsigned char zeros[PACK_ALIGNMENT] = { 0 };
+    size_t padding = (size_t)(AlignPackOffset(*offset) - *offset);
+    *offset += padding;
+
+    return fwrite(zeros, 1, padding, file) == padding;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+AssetPack LoadAssetPack(const char* fileName)
+{
+    AssetPack pack = { 0 };
+
+    MappedFile file = LoadMappedFile(fileName);
+    if (file.data == nullptr)
+    {
+        fprintf(stderr, "WARNING: FILEIO: [%s] Failed to open asset pack\n", fileName);
+        return pack;
+    }
+
+    PackHeader header = { 0 };
+    bool valid = (file.size >= sizeof(PackHeader));
+    if (valid)
+    {
+        memcpy(&header, file.data, sizeof(PackHeader));
+        valid = (header.magic == PACK_MAGIC) && (header.version == PACK_VERSION) && (header.tocOffset % alignof(PackEntry) == 0) &&
+            (header.tocOffset <= file.size) && ((file.size - header.tocOffset) / sizeof(PackEntry) >= header.entryCount) &&
+            (file.size - header.tocOffset - header.entryCount * sizeof(PackEntry) >= header.namesSize);
+    }
+
+    const PackEntry* entries = (const PackEntry*)(file.data + header.tocOffset);
+    for (uint32_t i = 0; valid && (i < header.entryCount); i++)
+    {
+        const PackEntry* entry = &entries[i];
+        valid = (entry->offset <= header.tocOffset) && (entry->storedSize <= header.tocOffset - entry->offset) &&
+            ((uint64_t)entry->nameOffset + entry->nameLength <= header.namesSize) &&
+            ((entry->compression == PACK_COMPRESSION_NONE)? (entry->storedSize == entry->size) :
+            ((entry->compression == PACK_COMPRESSION_LZ4) && (entry->size <= INT_MAX) && (entry->storedSize <= INT_MAX)));
+    }
+
+    if (!valid)
+    {
+        fprintf(stderr, "WARNING: FILEIO: [%s] Invalid asset pack\n", fileName);
+        UnloadMappedFile(file);
+        return pack;
+    }
+
+    pack.file = file;
+    pack.entries = entries;
+    pack.entryCount = (int)header.entryCount;
+    pack.names = (const char*)(file.data + header.tocOffset + header.entryCount * sizeof(PackEntry));
+
+    return pack;
+}
+
+void UnloadAssetPack(AssetPack pack)
+{
+    UnloadMappedFile(pack.file);
+}
+
+int FindPackEntry(const AssetPack* pack, const char* name)
+{
+    size_t length = strlen(name);
+    uint64_t hash = Checksum64(name, length);
+
+    // Binary search for the first entry with this hash, then compare names to rule out collisions
+    int low = 0, high = pack->entryCount;
+    while (low < high)
+    {
+        int middle = (low + high)/2;
+        if (pack->entries[middle].nameHash < hash) low = middle + 1;
+        else high = middle;
+    }
+
+    for (int i = low; (i < pack->entryCount) && (pack->entries[i].nameHash == hash); i++)
+    {
+        const PackEntry* entry = &pack->entries[i];
+        if ((entry->nameLength == length) && (memcmp(pack->names + entry->nameOffset, name, length) == 0)) return i;
+    }
+
+    return -1;
+}
+
+const void* GetPackData(const AssetPack* pack, int entry)
+{
+    if ((entry < 0) || (entry >= pack->entryCount) || (pack->entries[entry].compression != PACK_COMPRESSION_NONE)) return nullptr;
+
+    return pack->file.data + pack->entries[entry].offset;
+}
+
+bool ReadPackEntry(const AssetPack* pack, int entry, void* buffer, size_t bufferSize)
+{
+    if ((entry < 0) || (entry >= pack->entryCount)) return false;
+
+    const PackEntry* info = &pack->entries[entry];
+    const unsigned char* data = pack->file.data + info->offset;
+    if (bufferSize < info->size) return false;
+
+    if (info->compression == PACK_COMPRESSION_NONE)
+    {
+        memcpy(buffer, data, (size_t)info->size);
+        return true;
+    }
+
+    // NOTE: LZ4 entries are checked to fit the codec's int sizes by LoadAssetPack
+    return DecompressLz4(data, (int)info->storedSize, buffer, (int)info->size) == (int)info->size;
+}
+
+bool ExportAssetPack(const char* fileName, const PackSource* sources, int count)
+{
+    FILE* file = fopen(fileName, "wb");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "WARNING: FILEIO: [%s] Failed to create asset pack\n", fileName);
+        return false;
+    }
+
+    PackEntry* entries = (PackEntry*)calloc((count > 0)? count : 1, sizeof(PackEntry));
+    uint32_t namesSize = 0;
+    bool ok = true;
+
+    // Header placeholder, rewritten once the table of contents position is known
+    PackHeader header = { 0 };
+    uint64_t offset = sizeof(PackHeader);
+    ok = (fwrite(&header, sizeof(header), 1, file) == 1);
+
+    for (int i = 0; ok && (i < count); i++)
+    {
+        MappedFile source = LoadMappedFile(sources[i].path);
+        const unsigned char* data = source.data;
+        size_t size = source.size;
+
+        // NOTE: LoadMappedFile fails on empty files too, those are packed as empty entries
+        FILE* probe = (data == nullptr)? fopen(sources[i].path, "rb") : nullptr;
+        if ((data == nullptr) && (probe == nullptr))
+        {
+            fprintf(stderr, "WARNING: FILEIO: [%s] Failed to read file for packing\n", sources[i].path);
+            ok = false;
+            break;
+        }
+        if (probe != nullptr) fclose(probe);
+
+        PackEntry* entry = &entries[i];
+        entry->nameLength = (uint32_t)strlen(sources[i].name);
+        entry->nameOffset = namesSize;
+        entry->nameHash = Checksum64(sources[i].name, entry->nameLength);
+        entry->size = size;
+        entry->storedSize = size;
+        entry->compression = PACK_COMPRESSION_NONE;
+        namesSize += entry->nameLength;
+
+        unsigned char* compressed = nullptr;
+        if (sources[i].compress && (size > 0) && (size <= INT_MAX/2))
+        {
+            int bound = GetLz4Bound((int)size);
+            compressed = (unsigned char*)malloc(bound);
+            int compressedSize = CompressLz4(data, (int)size, compressed, bound);
+
+            if ((compressedSize > 0) && ((size_t)compressedSize <= size - size/PACK_MIN_SAVING))
+            {
+                entry->compression = PACK_COMPRESSION_LZ4;
+                entry->storedSize = (uint64_t)compressedSize;
+                data = compressed;
+            }
+        }
+
+        ok = WritePadding(file, &offset);
+        entry->offset = offset;
+        if (entry->storedSize > 0) ok = ok && (fwrite(data, 1, (size_t)entry->storedSize, file) == entry->storedSize);
+        offset += entry->storedSize;
+
+        free(compressed);
+        UnloadMappedFile(source);
+    }
+
+    // Table of contents sorted by name hash for FindPackEntry, names in source order
+    char* names = (char*)malloc(namesSize + 1);
+    for (int i = 0; i < count; i++) memcpy(names + entries[i].nameOffset, sources[i].name, entries[i].nameLength);
+    std::sort(entries, entries + count, [](const PackEntry& a, const PackEntry& b) { return a.nameHash < b.nameHash; });
+
+    ok = ok && WritePadding(file, &offset);
+    header.magic = PACK_MAGIC;
+    header.version = PACK_VERSION;
+    header.entryCount = (uint32_t)count;
+    header.namesSize = namesSize;
+    header.tocOffset = offset;
+
+    ok = ok && (fwrite(entries, sizeof(PackEntry), count, file) == (size_t)count);
+    ok = ok && (fwrite(names, 1, namesSize, file) == namesSize);
+    ok = ok && (fseek(file, 0, SEEK_SET) == 0) && (fwrite(&header, sizeof(header), 1, file) == 1);
+    ok = (fclose(file) == 0) && ok;
+
+    free(names);
+    free(entries);
+
+    if (!ok)
+    {
+        fprintf(stderr, "WARNING: FILEIO: [%s] Failed to write asset pack\n", fileName);
+        remove(fileName);
+    }
+
+    return ok;
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "MappedFile.h"
+
+// Single-file asset pack, built offline by the packer tool from the assets directory.
+// Layout: header, entry blobs (each starting on a PACK_ALIGNMENT boundary), then the table of contents sorted
+// by name hash and the name strings. The whole pack is memory-mapped once, uncompressed entries are used in
+// place without any copy, LZ4 compressed entries are decoded into a caller buffer.
+// Entry names are paths relative to the packed directory with '/' separators, e.g. "models/plane.obj".
+// NOTE: zstd is not supported, entries are either stored or LZ4 (see Lz4.h)
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define PACK_ALIGNMENT 64           // Byte alignment of every entry blob in the file
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Entry compression methods
+typedef enum {
+    PACK_COMPRESSION_NONE = 0,
+    PACK_COMPRESSION_LZ4
+} PackCompression;
+
+// Table of contents entry (on-disk layout)
+typedef struct PackEntry {
+    uint64_t nameHash;          // Checksum64 of the name
+    uint64_t offset;            // Blob position in the pack
+    uint64_t storedSize;        // Blob size in the pack
+    uint64_t size;              // Size once decompressed
+    uint32_t nameOffset;        // Into the name table
+    uint32_t nameLength;
+    uint32_t compression;       // PackCompression
+    uint32_t reserved;
+} PackEntry;
+
+// Asset pack type
+typedef struct AssetPack {
+    MappedFile file;
+    const PackEntry* entries;
+    int entryCount;
+    const char* names;          // Not NUL-terminated, use nameOffset/nameLength
+} AssetPack;
+
+// Packer input file
+typedef struct PackSource {
+    const char* name;           // Entry name
+    const char* path;           // File to read
+    bool compress;              // Try LZ4, kept only when it saves enough
+} PackSource;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+// Map an asset pack and validate its table of contents (entryCount is 0 on failure)
+AssetPack LoadAssetPack(const char* fileName);
+
+// Unmap an asset pack, pointers returned by GetPackData become invalid
+void UnloadAssetPack(AssetPack pack);
+
+// Find an entry by name, returns its index or -1
+int FindPackEntry(const AssetPack* pack, const char* name);
+
+// Get an entry's bytes in place, NULL for compressed entries (use ReadPackEntry)
+const void* GetPackData(const AssetPack* pack, int entry);
+
+// Decompress or copy an entry into buffer (at least entries[entry].size bytes), returns false on corrupt data
+bool ReadPackEntry(const AssetPack* pack, int entry, void* buffer, size_t bufferSize);
+
+// Write a pack from a list of files, returns false if any file can't be read or the pack can't be written
+bool ExportAssetPack(const char* fileName, const PackSource* sources, int count);
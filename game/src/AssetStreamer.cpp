@@ -0,0 +1,497 @@
+#include "AssetStreamer.h"
+#include "Mesh.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define ASSET_DEFAULT_IO_THREADS 2
+#define ASSET_MAX_PATH 1024
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Asset slot type
+typedef struct AssetSlot {
+    AssetState state;
+    uint32_t generation;
+    int type;
+    int priority;
+    uint64_t sequence;          // Request order, breaks priority ties first come first served
+    bool released;              // Released while an I/O thread held it, freed when the thread is done
+    void* data;                 // Decoded data, then the final asset
+    size_t uploadBytes;
+    char name[ASSET_MAX_NAME];
+} AssetSlot;
+
+struct AssetStreamer {
+    AssetBackend backend;
+    char root[ASSET_MAX_PATH];
+    const AssetPack* pack;
+
+    AssetType types[ASSET_MAX_TYPES];
+    int typeCount;
+
+    AssetSlot slots[ASSET_MAX_ASSETS];
+    int freeSlots[ASSET_MAX_ASSETS];
+    int freeCount;
+    uint64_t nextSequence;
+
+    // Slots waiting for an I/O thread, and decoded slots waiting for FinalizeAssets (unordered, scanned for the best)
+    int queue[ASSET_MAX_ASSETS];
+    int queueCount;
+    int decoded[ASSET_MAX_ASSETS];
+    int decodedCount;
+    size_t uploadedBytes;
+
+    std::mutex mutex;
+    std::condition_variable queued;
+    std::condition_variable finished;
+    std::thread* threads;
+    int threadCount;
+    bool stopping;
+};
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition - Built-in types
+//----------------------------------------------------------------------------------
+
+static void* DecodeBlob(const AssetSource* source, size_t* uploadBytes)
+{
+    AssetBlob* blob = (AssetBlob*)malloc(sizeof(AssetBlob));
+    blob->data = (unsigned char*)malloc(source->size + 1);
+    blob->size = source->size;
+    memcpy(blob->data, source->data, source->size);
+    blob->data[source->size] = '\0';        // Text assets can be used as C strings
+
+    *uploadBytes = 0;
+    return blob;
+}
+
+static void UnloadBlob(void* data)
+{
+    AssetBlob* blob = (AssetBlob*)data;
+    free(blob->data);
+    free(blob);
+}
+
+static void* DecodeMesh(const AssetSource* source, size_t* uploadBytes)
+{
+    // Loose files go through LoadMeshData to use (and refresh) the binary mesh cache
+    // NOTE: The parse jobs are submitted from this I/O thread, the workers run them while it waits
+    MeshData mesh = (source->path != nullptr)? LoadMeshData(source->path) : LoadMeshDataFromMemory((const char*)source->data, source->size);
+    if (mesh.indexCount == 0)
+    {
+        UnloadMeshData(mesh);
+        return nullptr;
+    }
+
+    MeshData* result = (MeshData*)malloc(sizeof(MeshData));
+    *result = mesh;
+
+    *uploadBytes = mesh.vertexCount * sizeof(MeshVertex) + (size_t)mesh.indexCount * mesh.indexSize;
+    return result;
+}
+
+static void UnloadMesh(void* data)
+{
+    UnloadMeshData(*(MeshData*)data);
+    free(data);
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition - Queues
+//----------------------------------------------------------------------------------
+
+// Remove and return the highest priority (then oldest) slot of a list, -1 when empty
+static int PopBest(AssetStreamer* streamer, int* list, int* count)
+{
+    if (*count == 0) return -1;
+
+    int best = 0;
+    for (int i = 1; i < *count; i++)
+    {
+        const AssetSlot* a = &streamer->slots[list[i]];
+        const AssetSlot* b = &streamer->slots[list[best]];
+        if ((a->priority > b->priority) || ((a->priority == b->priority) && (a->sequence < b->sequence))) best = i;
+    }
+
+    int slot = list[best];
+    list[best] = list[--*count];
+
+    return slot;
+}
+
+static bool RemoveFromList(int* list, int* count, int slot)
+{
+    for (int i = 0; i < *count; i++)
+    {
+        if (list[i] != slot) continue;
+        list[i] = list[--*count];
+        return true;
+    }
+
+    return false;
+}
+
+// Check if a slot's type has an upload step with this backend, without one the decoded data is the final asset
+static bool IsUploaded(const AssetStreamer* streamer, const AssetSlot* slot)
+{
+    return (streamer->backend == ASSET_BACKEND_GPU) && (streamer->types[slot->type].upload != nullptr);
+}
+
+// Free whatever a slot holds and return it to the free list, the mutex must be held
+static void FreeSlot(AssetStreamer* streamer, int index)
+{
+    AssetSlot* slot = &streamer->slots[index];
+    const AssetType* type = &streamer->types[slot->type];
+
+    if (slot->data != nullptr)
+    {
+        AssetFreeFunction unload = ((slot->state == ASSET_STATE_READY) && IsUploaded(streamer, slot))? type->unload : type->unloadDecoded;
+        if (unload != nullptr) unload(slot->data);
+    }
+
+    slot->state = ASSET_STATE_INVALID;
+    slot->data = nullptr;
+    slot->released = false;
+    slot->generation = (slot->generation == UINT32_MAX)? 1 : slot->generation + 1;
+    streamer->freeSlots[streamer->freeCount++] = index;
+}
+
+static AssetSlot* GetSlot(AssetStreamer* streamer, AssetHandle handle)
+{
+    if (handle.slot >= ASSET_MAX_ASSETS) return nullptr;
+
+    AssetSlot* slot = &streamer->slots[handle.slot];
+    return ((slot->generation == handle.generation) && (slot->state != ASSET_STATE_INVALID) && !slot->released)? slot : nullptr;
+}
+
+// Run the upload step of a decoded slot, the mutex must NOT be held
+static void FinalizeSlot(AssetStreamer* streamer, AssetSlot* slot)
+{
+    const AssetType* type = &streamer->types[slot->type];
+    void* result = slot->data;
+
+    if (IsUploaded(streamer, slot)) result = type->upload(slot->data);
+
+    std::lock_guard<std::mutex> lock(streamer->mutex);
+    slot->data = result;
+    slot->state = (result != nullptr)? ASSET_STATE_READY : ASSET_STATE_FAILED;
+    if ((result == nullptr) && (slot->name[0] != '\0')) fprintf(stderr, "WARNING: ASSET: [%s] Failed to upload asset\n", slot->name);
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition - I/O threads
+//----------------------------------------------------------------------------------
+
+// Read and decode one asset, runs without the mutex
+static void* LoadSlot(AssetStreamer* streamer, const AssetSlot* slot, const AssetType* type, size_t* uploadBytes)
+{
+    AssetSource source = { 0 };
+    source.name = slot->name;
+
+    void* result = nullptr;
+    int entry = (streamer->pack != nullptr)? FindPackEntry(streamer->pack, slot->name) : -1;
+
+    if (entry >= 0)
+    {
+        // Stored entries are decoded straight from the mapped pack, compressed ones through a temporary buffer
+        size_t size = (size_t)streamer->pack->entries[entry].size;
+        const unsigned char* data = (const unsigned char*)GetPackData(streamer->pack, entry);
+        unsigned char* buffer = nullptr;
+
+        if (data == nullptr)
+        {
+            buffer = (unsigned char*)malloc(size + 1);
+            if (ReadPackEntry(streamer->pack, entry, buffer, size)) data = buffer;
+        }
+
+        if (data != nullptr)
+        {
+            source.data = data;
+            source.size = size;
+            result = type->decode(&source, uploadBytes);
+        }
+
+        free(buffer);
+    }
+    else
+    {
+        char path[ASSET_MAX_PATH + ASSET_MAX_NAME + 1];
+        snprintf(path, sizeof(path), "%s/%s", streamer->root, slot->name);
+
+        MappedFile file = LoadMappedFile(path);
+        if (file.data != nullptr)
+        {
+            source.path = path;
+            source.data = file.data;
+            source.size = file.size;
+            result = type->decode(&source, uploadBytes);
+            UnloadMappedFile(file);
+        }
+    }
+
+    if (result == nullptr) fprintf(stderr, "WARNING: ASSET: [%s] Failed to load asset\n", slot->name);
+
+    return result;
+}
+
+static void IoThreadMain(AssetStreamer* streamer)
+{
+    std::unique_lock<std::mutex> lock(streamer->mutex);
+
+    while (true)
+    {
+        streamer->queued.wait(lock, [streamer]() { return streamer->stopping || (streamer->queueCount > 0); });
+        if (streamer->stopping) return;
+
+        int index = PopBest(streamer, streamer->queue, &streamer->queueCount);
+        AssetSlot* slot = &streamer->slots[index];
+        slot->state = ASSET_STATE_LOADING;
+
+        // NOTE: The slot name and type can't change while LOADING, a release only sets the released flag
+        lock.unlock();
+        size_t uploadBytes = 0;
+        void* data = LoadSlot(streamer, slot, &streamer->types[slot->type], &uploadBytes);
+        lock.lock();
+
+        slot->data = data;
+        slot->uploadBytes = uploadBytes;
+
+        if (slot->released)
+        {
+            slot->state = ASSET_STATE_DECODED;
+            FreeSlot(streamer, index);
+        }
+        else if (data == nullptr) slot->state = ASSET_STATE_FAILED;
+        else
+        {
+            slot->state = ASSET_STATE_DECODED;
+            streamer->decoded[streamer->decodedCount++] = index;
+        }
+
+        streamer->finished.notify_all();
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+AssetStreamer* LoadAssetStreamer(const char* rootDirectory, int ioThreads, AssetBackend backend)
+{
+    AssetStreamer* streamer = new AssetStreamer();
+
+    streamer->backend = backend;
+    snprintf(streamer->root, sizeof(streamer->root), "%s", (rootDirectory != nullptr)? rootDirectory : ".");
+
+    for (int i = 0; i < ASSET_MAX_ASSETS; i++)
+    {
+        streamer->slots[i].generation = 1;
+        streamer->freeSlots[i] = ASSET_MAX_ASSETS - 1 - i;
+    }
+    streamer->freeCount = ASSET_MAX_ASSETS;
+
+    RegisterAssetType(streamer, AssetType{ DecodeBlob, nullptr, UnloadBlob, UnloadBlob });
+    RegisterAssetType(streamer, AssetType{ DecodeMesh, nullptr, UnloadMesh, UnloadMesh });
+
+    streamer->threadCount = (ioThreads > 0)? ioThreads : ASSET_DEFAULT_IO_THREADS;
+    streamer->threads = new std::thread[streamer->threadCount];
+    for (int i = 0; i < streamer->threadCount; i++) streamer->threads[i] = std::thread(IoThreadMain, streamer);
+
+    return streamer;
+}
+
+void UnloadAssetStreamer(AssetStreamer* streamer)
+{
+    if (streamer == nullptr) return;
+
+    {
+        std::lock_guard<std::mutex> lock(streamer->mutex);
+        streamer->stopping = true;
+    }
+
+    streamer->queued.notify_all();
+    for (int i = 0; i < streamer->threadCount; i++) streamer->threads[i].join();
+    delete[] streamer->threads;
+
+    for (int i = 0; i < ASSET_MAX_ASSETS; i++)
+    {
+        if (streamer->slots[i].state != ASSET_STATE_INVALID) FreeSlot(streamer, i);
+    }
+
+    delete streamer;
+}
+
+int RegisterAssetType(AssetStreamer* streamer, AssetType type)
+{
+    if ((streamer->typeCount == ASSET_MAX_TYPES) || (type.decode == nullptr)) return -1;
+
+    std::lock_guard<std::mutex> lock(streamer->mutex);
+    streamer->types[streamer->typeCount] = type;
+
+    return streamer->typeCount++;
+}
+
+void MountAssetPack(AssetStreamer* streamer, const AssetPack* pack)
+{
+    std::lock_guard<std::mutex> lock(streamer->mutex);
+    streamer->pack = ((pack != nullptr) && (pack->entryCount > 0))? pack : nullptr;
+}
+
+AssetHandle RequestAsset(AssetStreamer* streamer, int type, const char* name, AssetPriority priority)
+{
+    AssetHandle handle = { 0 };
+    if ((type < 0) || (type >= streamer->typeCount) || (strlen(name) >= ASSET_MAX_NAME)) return handle;
+
+    std::lock_guard<std::mutex> lock(streamer->mutex);
+    if (streamer->freeCount == 0) return handle;
+
+    int index = streamer->freeSlots[--streamer->freeCount];
+    AssetSlot* slot = &streamer->slots[index];
+    slot->state = ASSET_STATE_QUEUED;
+    slot->type = type;
+    slot->priority = priority;
+    slot->sequence = streamer->nextSequence++;
+    slot->data = nullptr;
+    slot->uploadBytes = 0;
+    strcpy(slot->name, name);
+
+    streamer->queue[streamer->queueCount++] = index;
+    streamer->queued.notify_one();
+
+    handle.slot = (uint32_t)index;
+    handle.generation = slot->generation;
+
+    return handle;
+}
+
+void SetAssetPriority(AssetStreamer* streamer, AssetHandle handle, AssetPriority priority)
+{
+    std::lock_guard<std::mutex> lock(streamer->mutex);
+
+    AssetSlot* slot = GetSlot(streamer, handle);
+    if (slot != nullptr) slot->priority = priority;
+}
+
+AssetState GetAssetState(AssetStreamer* streamer, AssetHandle handle)
+{
+    std::lock_guard<std::mutex> lock(streamer->mutex);
+
+    AssetSlot* slot = GetSlot(streamer, handle);
+    return (slot != nullptr)? slot->state : ASSET_STATE_INVALID;
+}
+
+void* GetAsset(AssetStreamer* streamer, AssetHandle handle)
+{
+    std::lock_guard<std::mutex> lock(streamer->mutex);
+
+    AssetSlot* slot = GetSlot(streamer, handle);
+    return ((slot != nullptr) && (slot->state == ASSET_STATE_READY))? slot->data : nullptr;
+}
+
+AssetState WaitForAsset(AssetStreamer* streamer, AssetHandle handle)
+{
+    std::unique_lock<std::mutex> lock(streamer->mutex);
+
+    AssetSlot* slot = GetSlot(streamer, handle);
+    if (slot == nullptr) return ASSET_STATE_INVALID;
+
+    slot->priority = ASSET_PRIORITY_IMMEDIATE;
+    streamer->finished.wait(lock, [slot]() { return (slot->state != ASSET_STATE_QUEUED) && (slot->state != ASSET_STATE_LOADING); });
+
+    if (slot->state == ASSET_STATE_DECODED)
+    {
+        RemoveFromList(streamer->decoded, &streamer->decodedCount, (int)handle.slot);
+        lock.unlock();
+        FinalizeSlot(streamer, slot);
+        lock.lock();
+    }
+
+    return slot->state;
+}
+
+void ReleaseAsset(AssetStreamer* streamer, AssetHandle handle)
+{
+    std::lock_guard<std::mutex> lock(streamer->mutex);
+
+    AssetSlot* slot = GetSlot(streamer, handle);
+    if (slot == nullptr) return;
+
+    if (slot->state == ASSET_STATE_LOADING)
+    {
+        // The I/O thread frees it once it is done
+        slot->released = true;
+        return;
+    }
+
+    RemoveFromList(streamer->queue, &streamer->queueCount, (int)handle.slot);
+    RemoveFromList(streamer->decoded, &streamer->decodedCount, (int)handle.slot);
+    FreeSlot(streamer, (int)handle.slot);
+}
+
+int FinalizeAssets(AssetStreamer* streamer, size_t byteBudget, double timeBudget)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    size_t usedBytes = 0;
+    int finalized = 0;
+
+    while (true)
+    {
+        AssetSlot* slot = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(streamer->mutex);
+
+            // Peek the best candidate, stop (after the first) when it would overrun the byte budget
+            int index = PopBest(streamer, streamer->decoded, &streamer->decodedCount);
+            if (index < 0) break;
+
+            slot = &streamer->slots[index];
+            if ((finalized > 0) && (usedBytes + slot->uploadBytes > byteBudget))
+            {
+                streamer->decoded[streamer->decodedCount++] = index;
+                break;
+            }
+        }
+
+        FinalizeSlot(streamer, slot);
+        usedBytes += slot->uploadBytes;
+        finalized++;
+
+        if (std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() >= timeBudget) break;
+    }
+
+    streamer->uploadedBytes = usedBytes;
+
+    return finalized;
+}
+
+AssetStreamStats GetAssetStreamStats(AssetStreamer* streamer)
+{
+    AssetStreamStats stats = { 0 };
+    std::lock_guard<std::mutex> lock(streamer->mutex);
+
+    for (int i = 0; i < ASSET_MAX_ASSETS; i++)
+    {
+        const AssetSlot* slot = &streamer->slots[i];
+        if (slot->released) continue;
+
+        if (slot->state == ASSET_STATE_QUEUED) stats.queued++;
+        else if (slot->state == ASSET_STATE_LOADING) stats.loading++;
+        else if (slot->state == ASSET_STATE_DECODED) stats.decoded++;
+        else if (slot->state == ASSET_STATE_READY) stats.ready++;
+        else if (slot->state == ASSET_STATE_FAILED) stats.failed++;
+    }
+
+    stats.uploadedBytes = streamer->uploadedBytes;
+
+    return stats;
+}
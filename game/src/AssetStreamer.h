@@ -0,0 +1,146 @@
+#pragma once
+#include "AssetPack.h"
+
+// Asynchronous asset streaming.
+// Requests go into a priority queue served by a small fixed pool of I/O threads, each thread reads the asset
+// (from a mounted pack, else as a loose file under the root directory) and decodes it with its type's decode
+// function. Decoded assets then wait for FinalizeAssets, called once per frame on the main thread, which runs
+// the GPU side (texture/sound creation) within a byte and time budget so streaming never stalls a frame.
+// Requests return handles, poll GetAssetState or block in WaitForAsset, then read the result with GetAsset.
+// With ASSET_BACKEND_NULL the upload step is skipped and the decoded data is the result, so every asset type
+// loads without a GPU or audio device (headless runs, tools, tests).
+// NOTE: Everything except the decode functions runs on the thread that created the streamer
+// NOTE: Decode functions may submit jobs (the OBJ parse does), they go to the job system's shared queue
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define ASSET_MAX_ASSETS 1024           // Assets alive at once (requested and not released)
+#define ASSET_MAX_TYPES 16
+#define ASSET_MAX_NAME 256
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Built-in asset types, RegisterAssetType hands out the following ids
+typedef enum {
+    ASSET_TYPE_BLOB = 0,                // AssetBlob, raw file bytes
+    ASSET_TYPE_MESH,                    // MeshData, OBJ parsed (through the mesh cache for loose files)
+    ASSET_TYPE_BUILTIN_COUNT
+} AssetTypeId;
+
+// Request priorities, higher priorities are read and finalized first
+typedef enum {
+    ASSET_PRIORITY_LOW = 0,
+    ASSET_PRIORITY_NORMAL,
+    ASSET_PRIORITY_HIGH,
+    ASSET_PRIORITY_IMMEDIATE            // Set by WaitForAsset
+} AssetPriority;
+
+// Asset request states
+typedef enum {
+    ASSET_STATE_INVALID = 0,            // Unknown or released handle
+    ASSET_STATE_QUEUED,
+    ASSET_STATE_LOADING,                // Being read and decoded
+    ASSET_STATE_DECODED,                // Waiting for FinalizeAssets
+    ASSET_STATE_READY,
+    ASSET_STATE_FAILED
+} AssetState;
+
+// Upload backends
+typedef enum {
+    ASSET_BACKEND_GPU = 0,              // Call the type upload functions
+    ASSET_BACKEND_NULL                  // Skip uploads, decoded data is the final asset
+} AssetBackend;
+
+// Asset handle type, generation 0 is never handed out
+typedef struct AssetHandle {
+    uint32_t slot;
+    uint32_t generation;
+} AssetHandle;
+
+// Asset bytes as read by the I/O thread
+typedef struct AssetSource {
+    const char* name;                   // Requested name
+    const char* path;                   // Loose file path, NULL when read from a pack
+    const unsigned char* data;          // Only valid during the decode call
+    size_t size;
+} AssetSource;
+
+// Blob asset type
+typedef struct AssetBlob {
+    unsigned char* data;
+    size_t size;
+} AssetBlob;
+
+// Runs on an I/O thread: decode source, set uploadBytes to the cost charged to the upload budget, NULL on failure
+typedef void* (*AssetDecodeFunction)(const AssetSource* source, size_t* uploadBytes);
+
+// Runs on the main thread: create the final asset from decoded data (and free it), NULL on failure
+typedef void* (*AssetUploadFunction)(void* decoded);
+
+// Free decoded data or a final asset
+typedef void (*AssetFreeFunction)(void* data);
+
+// Asset type callbacks
+typedef struct AssetType {
+    AssetDecodeFunction decode;
+    AssetUploadFunction upload;         // NULL when there is no GPU step
+    AssetFreeFunction unloadDecoded;    // Frees data that was decoded but never uploaded
+    AssetFreeFunction unload;           // Frees the final asset
+} AssetType;
+
+// Streaming statistics
+typedef struct AssetStreamStats {
+    int queued;
+    int loading;
+    int decoded;
+    int ready;
+    int failed;
+    size_t uploadedBytes;               // Charged by the last FinalizeAssets
+} AssetStreamStats;
+
+// Opaque streamer type
+typedef struct AssetStreamer AssetStreamer;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+// Start a streamer reading loose files under rootDirectory with ioThreads threads (<= 0 picks 2)
+AssetStreamer* LoadAssetStreamer(const char* rootDirectory, int ioThreads, AssetBackend backend);
+
+// Stop the I/O threads and free every asset still loaded
+void UnloadAssetStreamer(AssetStreamer* streamer);
+
+// Register an asset type, returns its id or -1 when ASSET_MAX_TYPES are in use
+int RegisterAssetType(AssetStreamer* streamer, AssetType type);
+
+// Look names up in a pack before the root directory, the pack must outlive the streamer
+void MountAssetPack(AssetStreamer* streamer, const AssetPack* pack);
+
+// Queue an asset load, returns a null handle (generation 0) when ASSET_MAX_ASSETS are alive
+AssetHandle RequestAsset(AssetStreamer* streamer, int type, const char* name, AssetPriority priority);
+
+// Change the priority of a request still waiting to be read or finalized
+void SetAssetPriority(AssetStreamer* streamer, AssetHandle handle, AssetPriority priority);
+
+// Get the state of a request
+AssetState GetAssetState(AssetStreamer* streamer, AssetHandle handle);
+
+// Get a loaded asset (its type's final data, e.g. AssetBlob* or MeshData*), NULL until ASSET_STATE_READY
+void* GetAsset(AssetStreamer* streamer, AssetHandle handle);
+
+// Block until an asset is ready or failed, finalizing it right away regardless of budgets
+AssetState WaitForAsset(AssetStreamer* streamer, AssetHandle handle);
+
+// Unload an asset (or cancel its request), the handle becomes invalid
+void ReleaseAsset(AssetStreamer* streamer, AssetHandle handle);
+
+// Finalize decoded assets, highest priority first, until byteBudget or timeBudget (seconds) is used up
+// NOTE: At least one asset is finalized per call so an asset larger than the budget still gets through
+int FinalizeAssets(AssetStreamer* streamer, size_t byteBudget, double timeBudget);
+
+// Get streaming statistics
+AssetStreamStats GetAssetStreamStats(AssetStreamer* streamer);
@@ -0,0 +1,745 @@
+#pragma once
+#include "MathBatch.h"
+#include "Grid.h"
+#include <cstring>
+
+// 2D narrowphase: exact overlap tests that return a contact manifold.
+// The contact normal points from shape A (first argument) towards shape B, moving B by normal * depth
+// (or A by -normal * depth) separates the shapes. Rectangles are Aabb boxes.
+// Batch entry points test one shape against a whole obstacle set (or circle array) four lanes at a time
+// and only build manifolds for the lanes that hit.
+// Continuous queries (Raycast, Sweep) return the time of impact along a motion instead, so fast
+// projectiles can't tunnel through thin obstacles between two fixed steps.
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define SWEEP_MAX_CANDIDATES 256        // Obstacles considered per projectile by the grid-driven Sweep
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Circle type
+typedef struct Circle {
+    Vector2 center;
+    float radius;
+} Circle;
+
+// Segment type
+typedef struct Segment {
+    Vector2 start;
+    Vector2 end;
+} Segment;
+
+// Capsule type (segment thickened by radius)
+typedef struct Capsule {
+    Vector2 start;
+    Vector2 end;
+    float radius;
+} Capsule;
+
+// Contact manifold type
+typedef struct Contact {
+    Vector2 normal;     // Unit direction from shape A towards shape B
+    Vector2 point;      // Contact point in world space
+    float depth;        // Penetration depth along normal
+} Contact;
+
+// Time of impact type
+typedef struct Impact {
+    float time;         // Fraction of the motion travelled before touching (0 = already touching)
+    Vector2 normal;     // Surface normal of the obstacle at the impact, facing the moving shape
+    Vector2 point;      // Contact point in world space
+} Impact;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Helpers
+//----------------------------------------------------------------------------------
+
+// Clip the segment from start to end against the box, returns false if it misses
+// NOTE: On a hit, [*tmin, *tmax] is the part of the segment inside the box (0 = start, 1 = end)
+RMAPI bool ClipSegment(Aabb box, Vector2 start, Vector2 end, float* tmin, float* tmax)
+{
+    float t0 = 0.0f;
+    float t1 = 1.0f;
+    float d[2] = { end.x - start.x, end.y - start.y };
+    float s[2] = { start.x, start.y };
+    float lo[2] = { box.min.x, box.min.y };
+    float hi[2] = { box.max.x, box.max.y };
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (fabsf(d[i]) < EPSILON)
+        {
+            if ((s[i] < lo[i]) || (s[i] > hi[i])) return false;
+        }
+        else
+        {
+            float inv = 1.0f / d[i];
+            float ta = (lo[i] - s[i]) * inv;
+            float tb = (hi[i] - s[i]) * inv;
+            if (ta > tb) { float t = ta; ta = tb; tb = t; }
+            if (ta > t0) t0 = ta;
+            if (tb < t1) t1 = tb;
+            if (t0 > t1) return false;
+        }
+    }
+
+    *tmin = t0;
+    *tmax = t1;
+
+    return true;
+}
+
+// Get the closest points between segments p1-q1 and p2-q2
+RMAPI void ClosestPoints(Vector2 p1, Vector2 q1, Vector2 p2, Vector2 q2, Vector2* c1, Vector2* c2)
+{
+    Vector2 d1 = Subtract(q1, p1);
+    Vector2 d2 = Subtract(q2, p2);
+    Vector2 r = Subtract(p1, p2);
+    float a = Dot(d1, d1);
+    float e = Dot(d2, d2);
+    float f = Dot(d2, r);
+    float s = 0.0f;
+    float t = 0.0f;
+
+    if ((a <= EPSILON) && (e <= EPSILON)) { }
+    else if (a <= EPSILON) t = Clamp(f / e, 0.0f, 1.0f);
+    else
+    {
+        float c = Dot(d1, r);
+        if (e <= EPSILON) s = Clamp(-c / a, 0.0f, 1.0f);
+        else
+        {
+            float b = Dot(d1, d2);
+            float denom = a * e - b * b;
+
+            // Parallel segments: any s works, start from p1
+            if (denom > 0.0f) s = Clamp((b * f - c * e) / denom, 0.0f, 1.0f);
+            t = (b * s + f) / e;
+
+            if (t < 0.0f)
+            {
+                t = 0.0f;
+                s = Clamp(-c / a, 0.0f, 1.0f);
+            }
+            else if (t > 1.0f)
+            {
+                t = 1.0f;
+                s = Clamp((b - c) / a, 0.0f, 1.0f);
+            }
+        }
+    }
+
+    *c1 = Add(p1, Scale(d1, s));
+    *c2 = Add(p2, Scale(d2, t));
+}
+
+// Build the manifold between two circles once their centers are known
+// NOTE: Coincident centers fall back to separating along fallback
+RMAPI bool CollideSpheres(Vector2 a, float ra, Vector2 b, float rb, Vector2 fallback, Contact* contact)
+{
+    float radius = ra + rb;
+    float distanceSqr = DistanceSqr(a, b);
+    if (distanceSqr > radius * radius) return false;
+
+    float distance = sqrtf(distanceSqr);
+    contact->normal = (distance > EPSILON)? Scale(Subtract(b, a), 1.0f / distance) : fallback;
+    contact->depth = radius - distance;
+    contact->point = Add(a, Scale(contact->normal, ra - 0.5f * contact->depth));
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Narrowphase
+//----------------------------------------------------------------------------------
+
+// Collide two circles
+RMAPI bool Collide(Circle a, Circle b, Contact* contact)
+{
+    return CollideSpheres(a.center, a.radius, b.center, b.radius, Vector2{ 0.0f, 1.0f }, contact);
+}
+
+// Collide a circle with a rectangle
+RMAPI bool Collide(Circle a, Aabb b, Contact* contact)
+{
+    Vector2 closest = ClosestPoint(b, a.center);
+    float distanceSqr = DistanceSqr(closest, a.center);
+    if (distanceSqr > a.radius * a.radius) return false;
+
+    if (distanceSqr > EPSILON * EPSILON)
+    {
+        // Center outside the box
+        float distance = sqrtf(distanceSqr);
+        contact->normal = Scale(Subtract(closest, a.center), 1.0f / distance);
+        contact->depth = a.radius - distance;
+        contact->point = closest;
+        return true;
+    }
+
+    // Center inside the box: push out through the nearest face
+    float faces[4] = { a.center.x - b.min.x, b.max.x - a.center.x, a.center.y - b.min.y, b.max.y - a.center.y };
+    Vector2 normals[4] = { { 1.0f, 0.0f }, { -1.0f, 0.0f }, { 0.0f, 1.0f }, { 0.0f, -1.0f } };
+    int face = 0;
+
+    for (int i = 1; i < 4; i++)
+    {
+        if (faces[i] < faces[face]) face = i;
+    }
+
+    contact->normal = normals[face];
+    contact->depth = a.radius + faces[face];
+    contact->point = Subtract(a.center, Scale(normals[face], faces[face]));
+
+    return true;
+}
+
+// Collide two rectangles
+RMAPI bool Collide(Aabb a, Aabb b, Contact* contact)
+{
+    Aabb overlap = { { fmaxf(a.min.x, b.min.x), fmaxf(a.min.y, b.min.y) }, { fminf(a.max.x, b.max.x), fminf(a.max.y, b.max.y) } };
+    if ((overlap.min.x > overlap.max.x) || (overlap.min.y > overlap.max.y)) return false;
+
+    // Separate along the shortest of the four pushes that move b clear of a
+    float push[4] = { a.max.x - b.min.x, b.max.x - a.min.x, a.max.y - b.min.y, b.max.y - a.min.y };
+    Vector2 normals[4] = { { 1.0f, 0.0f }, { -1.0f, 0.0f }, { 0.0f, 1.0f }, { 0.0f, -1.0f } };
+    int best = 0;
+
+    for (int i = 1; i < 4; i++)
+    {
+        if (push[i] < push[best]) best = i;
+    }
+
+    contact->normal = normals[best];
+    contact->depth = push[best];
+    contact->point = Scale(Add(overlap.min, overlap.max), 0.5f);
+
+    return true;
+}
+
+// Collide a capsule with a circle
+RMAPI bool Collide(Capsule a, Circle b, Contact* contact)
+{
+    if (DistanceSqr(a.start, a.end) <= EPSILON) return Collide(Circle{ a.start, a.radius }, b, contact);
+
+    Vector2 axis = Normalize(Subtract(a.end, a.start));
+    Vector2 closest = ProjectPointLine(a.start, a.end, b.center);
+
+    return CollideSpheres(closest, a.radius, b.center, b.radius, Vector2{ -axis.y, axis.x }, contact);
+}
+
+// Collide a segment with a circle
+RMAPI bool Collide(Segment a, Circle b, Contact* contact)
+{
+    return Collide(Capsule{ a.start, a.end, 0.0f }, b, contact);
+}
+
+// Collide two capsules
+RMAPI bool Collide(Capsule a, Capsule b, Contact* contact)
+{
+    Vector2 ca, cb;
+    ClosestPoints(a.start, a.end, b.start, b.end, &ca, &cb);
+
+    float radius = a.radius + b.radius;
+    float distanceSqr = DistanceSqr(ca, cb);
+    if (distanceSqr > radius * radius) return false;
+    if (distanceSqr > EPSILON) return CollideSpheres(ca, a.radius, cb, b.radius, Vector2{ 0.0f, 1.0f }, contact);
+
+    // Crossing cores: push b clear along the shortest of the two segment normals
+    Segment cores[2] = { { a.start, a.end }, { b.start, b.end } };
+    float best = INFINITY;
+
+    for (int i = 0; i < 2; i++)
+    {
+        Vector2 axis = Subtract(cores[i].end, cores[i].start);
+        if (Dot(axis, axis) <= EPSILON) continue;
+
+        Vector2 normal = Normalize(Vector2{ -axis.y, axis.x });
+        float pa[2] = { Dot(normal, a.start), Dot(normal, a.end) };
+        float pb[2] = { Dot(normal, b.start), Dot(normal, b.end) };
+        float forward = fmaxf(pa[0], pa[1]) - fminf(pb[0], pb[1]) + radius;
+        float backward = fmaxf(pb[0], pb[1]) - fminf(pa[0], pa[1]) + radius;
+
+        if (forward < best) { best = forward; contact->normal = normal; }
+        if (backward < best) { best = backward; contact->normal = Negate(normal); }
+    }
+
+    // Both cores degenerate to the same point
+    if (best == INFINITY) return CollideSpheres(ca, a.radius, cb, b.radius, Vector2{ 0.0f, 1.0f }, contact);
+
+    contact->depth = best;
+    contact->point = Scale(Add(ca, cb), 0.5f);
+
+    return true;
+}
+
+// Collide a capsule with a rectangle
+RMAPI bool Collide(Capsule a, Aabb b, Contact* contact)
+{
+    if (DistanceSqr(a.start, a.end) <= EPSILON) return Collide(Circle{ a.start, a.radius }, b, contact);
+
+    float tmin, tmax;
+
+    if (!ClipSegment(b, a.start, a.end, &tmin, &tmax))
+    {
+        // Disjoint core: the closest pair involves a segment endpoint or a box corner
+        Vector2 corners[4] = { b.min, { b.max.x, b.min.y }, b.max, { b.min.x, b.max.y } };
+        Vector2 onSegment = a.start;
+        Vector2 onBox = ClosestPoint(b, a.start);
+        float best = DistanceSqr(onSegment, onBox);
+
+        Vector2 endOnBox = ClosestPoint(b, a.end);
+        if (DistanceSqr(a.end, endOnBox) < best) { onSegment = a.end; onBox = endOnBox; best = DistanceSqr(a.end, endOnBox); }
+
+        for (int i = 0; i < 4; i++)
+        {
+            Vector2 projected = ProjectPointLine(a.start, a.end, corners[i]);
+            float distanceSqr = DistanceSqr(projected, corners[i]);
+            if (distanceSqr < best) { onSegment = projected; onBox = corners[i]; best = distanceSqr; }
+        }
+
+        if (best > a.radius * a.radius) return false;
+
+        float distance = sqrtf(best);
+        contact->normal = Scale(Subtract(onBox, onSegment), 1.0f / distance);
+        contact->depth = a.radius - distance;
+        contact->point = onBox;
+        return true;
+    }
+
+    // Core crosses the box: separating axis of least penetration among x, y and the segment normal
+    Vector2 axis = Normalize(Subtract(a.end, a.start));
+    Vector2 normal = { -axis.y, axis.x };
+    Vector2 corners[4] = { b.min, { b.max.x, b.min.y }, b.max, { b.min.x, b.max.y } };
+    float k = Dot(normal, a.start);
+    float lo = Dot(normal, corners[0]);
+    float hi = lo;
+
+    for (int i = 1; i < 4; i++)
+    {
+        float p = Dot(normal, corners[i]);
+        lo = fminf(lo, p);
+        hi = fmaxf(hi, p);
+    }
+
+    // Distance to push b along +axis or -axis until it clears the core
+    float push[6] = {
+        fmaxf(a.start.x, a.end.x) - b.min.x, b.max.x - fminf(a.start.x, a.end.x),
+        fmaxf(a.start.y, a.end.y) - b.min.y, b.max.y - fminf(a.start.y, a.end.y),
+        k - lo, hi - k
+    };
+    Vector2 normals[6] = { { 1.0f, 0.0f }, { -1.0f, 0.0f }, { 0.0f, 1.0f }, { 0.0f, -1.0f }, normal, Negate(normal) };
+    int best = 0;
+
+    for (int i = 1; i < 6; i++)
+    {
+        if (push[i] < push[best]) best = i;
+    }
+
+    contact->normal = normals[best];
+    contact->depth = push[best] + a.radius;
+    contact->point = Lerp(a.start, a.end, 0.5f * (tmin + tmax));
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Batch narrowphase
+//----------------------------------------------------------------------------------
+
+// Test a circle against every obstacle, writes the index and contact of each hit, returns the hit count
+RMAPI int Collide(Circle circle, const Obstacles* rects, int* hitIds, Contact* contacts, int maxOut)
+{
+    int hits = 0;
+    int i = 0;
+    if (maxOut <= 0) return hits;
+
+#if defined(MATH_SIMD4)
+    float4 cx = Set4(circle.center.x);
+    float4 cy = Set4(circle.center.y);
+    float4 radiusSqr = Set4(circle.radius * circle.radius);
+    float4 zero = Set4(0.0f);
+
+    for (; i + 4 <= rects->count; i += 4)
+    {
+        float4 x0 = Load4(rects->x + i);
+        float4 y0 = Load4(rects->y + i);
+        float4 x1 = Add4(x0, Load4(rects->w + i));
+        float4 y1 = Add4(y0, Load4(rects->h + i));
+
+        // Per-axis distance from the center to the box (0 inside the slab)
+        float4 dx = Max4(Max4(Sub4(x0, cx), Sub4(cx, x1)), zero);
+        float4 dy = Max4(Max4(Sub4(y0, cy), Sub4(cy, y1)), zero);
+        int mask = MoveMask4(LessEqual4(Add4(Mul4(dx, dx), Mul4(dy, dy)), radiusSqr));
+
+        for (; mask != 0; mask &= mask - 1)
+        {
+            int id = i + LowestLane4(mask);
+            if (Collide(circle, GetObstacleBounds(rects, id), &contacts[hits]))
+            {
+                hitIds[hits++] = id;
+                if (hits == maxOut) return hits;
+            }
+        }
+    }
+#endif
+
+    for (; i < rects->count; i++)
+    {
+        if (Collide(circle, GetObstacleBounds(rects, i), &contacts[hits]))
+        {
+            hitIds[hits++] = i;
+            if (hits == maxOut) return hits;
+        }
+    }
+
+    return hits;
+}
+
+#if defined(MATH_SIMD4)
+// Clip the segment start + d*t, t in [0, 1] against four boxes, returns the lanes where it crosses
+// NOTE: invd is 1/d per axis, lanes along an axis with no motion pass only if start lies inside that slab
+RMAPI mask4 ClipSegment4(float4 x0, float4 y0, float4 x1, float4 y1, Vector2 start, Vector2 d, Vector2 invd)
+{
+    float4 tmin = Set4(0.0f);
+    float4 tmax = Set4(1.0f);
+
+    if (fabsf(d.x) >= EPSILON)
+    {
+        float4 ta = Mul4(Sub4(x0, Set4(start.x)), Set4(invd.x));
+        float4 tb = Mul4(Sub4(x1, Set4(start.x)), Set4(invd.x));
+        tmin = Max4(tmin, Min4(ta, tb));
+        tmax = Min4(tmax, Max4(ta, tb));
+    }
+    else
+    {
+        float4 sx = Set4(start.x);
+        tmax = Select4(And4(LessEqual4(x0, sx), LessEqual4(sx, x1)), tmax, Set4(-1.0f));
+    }
+
+    if (fabsf(d.y) >= EPSILON)
+    {
+        float4 ta = Mul4(Sub4(y0, Set4(start.y)), Set4(invd.y));
+        float4 tb = Mul4(Sub4(y1, Set4(start.y)), Set4(invd.y));
+        tmin = Max4(tmin, Min4(ta, tb));
+        tmax = Min4(tmax, Max4(ta, tb));
+    }
+    else
+    {
+        float4 sy = Set4(start.y);
+        tmax = Select4(And4(LessEqual4(y0, sy), LessEqual4(sy, y1)), tmax, Set4(-1.0f));
+    }
+
+    return LessEqual4(tmin, tmax);
+}
+
+// Check which of four corners lie within radius of the segment start + d*t (ProjectPointLine per lane)
+RMAPI mask4 CornerNear4(float4 px, float4 py, Vector2 start, Vector2 d, float invLengthSqr, float radiusSqr)
+{
+    float4 rx = Sub4(px, Set4(start.x));
+    float4 ry = Sub4(py, Set4(start.y));
+    float4 t = Mul4(Add4(Mul4(rx, Set4(d.x)), Mul4(ry, Set4(d.y))), Set4(invLengthSqr));
+    t = Min4(Max4(t, Set4(0.0f)), Set4(1.0f));
+
+    float4 ex = Sub4(rx, Mul4(Set4(d.x), t));
+    float4 ey = Sub4(ry, Mul4(Set4(d.y), t));
+
+    return LessEqual4(Add4(Mul4(ex, ex), Mul4(ey, ey)), Set4(radiusSqr));
+}
+#endif
+
+// Test a capsule (a laser or a fast bullet's path) against every obstacle, returns the hit count
+RMAPI int Collide(Capsule capsule, const Obstacles* rects, int* hitIds, Contact* contacts, int maxOut)
+{
+    Vector2 d = Subtract(capsule.end, capsule.start);
+    float lengthSqr = Dot(d, d);
+    if (lengthSqr <= EPSILON) return Collide(Circle{ capsule.start, capsule.radius }, rects, hitIds, contacts, maxOut);
+
+    int hits = 0;
+    int i = 0;
+    if (maxOut <= 0) return hits;
+
+#if defined(MATH_SIMD4)
+    Vector2 invd = { (fabsf(d.x) >= EPSILON)? 1.0f / d.x : 0.0f, (fabsf(d.y) >= EPSILON)? 1.0f / d.y : 0.0f };
+    float invLengthSqr = 1.0f / lengthSqr;
+    float radiusSqr = capsule.radius * capsule.radius;
+    float4 r = Set4(capsule.radius);
+
+    for (; i + 4 <= rects->count; i += 4)
+    {
+        float4 x0 = Load4(rects->x + i);
+        float4 y0 = Load4(rects->y + i);
+        float4 x1 = Add4(x0, Load4(rects->w + i));
+        float4 y1 = Add4(y0, Load4(rects->h + i));
+
+        // Box rounded by the radius = two inflated slabs plus four corner circles
+        mask4 hit = Or4(ClipSegment4(Sub4(x0, r), y0, Add4(x1, r), y1, capsule.start, d, invd),
+            ClipSegment4(x0, Sub4(y0, r), x1, Add4(y1, r), capsule.start, d, invd));
+
+        if (capsule.radius > 0.0f)
+        {
+            hit = Or4(hit, Or4(CornerNear4(x0, y0, capsule.start, d, invLengthSqr, radiusSqr),
+                CornerNear4(x1, y0, capsule.start, d, invLengthSqr, radiusSqr)));
+            hit = Or4(hit, Or4(CornerNear4(x1, y1, capsule.start, d, invLengthSqr, radiusSqr),
+                CornerNear4(x0, y1, capsule.start, d, invLengthSqr, radiusSqr)));
+        }
+
+        for (int mask = MoveMask4(hit); mask != 0; mask &= mask - 1)
+        {
+            int id = i + LowestLane4(mask);
+            if (Collide(capsule, GetObstacleBounds(rects, id), &contacts[hits]))
+            {
+                hitIds[hits++] = id;
+                if (hits == maxOut) return hits;
+            }
+        }
+    }
+#endif
+
+    for (; i < rects->count; i++)
+    {
+        if (Collide(capsule, GetObstacleBounds(rects, i), &contacts[hits]))
+        {
+            hitIds[hits++] = i;
+            if (hits == maxOut) return hits;
+        }
+    }
+
+    return hits;
+}
+
+// Test a circle against an array of circles, returns the hit count
+RMAPI int Collide(Circle circle, const Circle* circles, int count, int* hitIds, Contact* contacts, int maxOut)
+{
+    int hits = 0;
+    int i = 0;
+    if (maxOut <= 0) return hits;
+
+#if defined(MATH_SIMD4)
+    float4 cx = Set4(circle.center.x);
+    float4 cy = Set4(circle.center.y);
+    float4 cr = Set4(circle.radius);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        // NOTE: Circle is three packed floats, copied as Vector3 rather than accessed through a cast pointer,
+        // which would break strict aliasing. The copy compiles down to the same three loads
+        static_assert(sizeof(Circle) == sizeof(Vector3), "Circle must pack like Vector3");
+        Vector3 packed[4];
+        memcpy(packed, &circles[i], sizeof(packed));
+
+        float4 x, y, radius;
+        Load3x4(packed, &x, &y, &radius);
+
+        float4 dx = Sub4(x, cx);
+        float4 dy = Sub4(y, cy);
+        float4 reach = Add4(radius, cr);
+        int mask = MoveMask4(LessEqual4(Add4(Mul4(dx, dx), Mul4(dy, dy)), Mul4(reach, reach)));
+
+        for (; mask != 0; mask &= mask - 1)
+        {
+            int id = i + LowestLane4(mask);
+            if (Collide(circle, circles[id], &contacts[hits]))
+            {
+                hitIds[hits++] = id;
+                if (hits == maxOut) return hits;
+            }
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        if (Collide(circle, circles[i], &contacts[hits]))
+        {
+            hitIds[hits++] = i;
+            if (hits == maxOut) return hits;
+        }
+    }
+
+    return hits;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Continuous collision
+//----------------------------------------------------------------------------------
+
+// Cast a ray from start to end against a rectangle
+// NOTE: A ray starting inside the box hits at time 0, with the normal facing against the motion
+RMAPI bool Raycast(Aabb box, Vector2 start, Vector2 end, Impact* impact)
+{
+    Vector2 d = Subtract(end, start);
+    Vector2 normal = { 0.0f, 0.0f };
+    float tmin = 0.0f;
+    float tmax = 1.0f;
+    float dir[2] = { d.x, d.y };
+    float s[2] = { start.x, start.y };
+    float lo[2] = { box.min.x, box.min.y };
+    float hi[2] = { box.max.x, box.max.y };
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (fabsf(dir[i]) < EPSILON)
+        {
+            if ((s[i] < lo[i]) || (s[i] > hi[i])) return false;
+            continue;
+        }
+
+        // Entering through the low face means the surface faces towards -axis
+        float inv = 1.0f / dir[i];
+        float ta = (lo[i] - s[i]) * inv;
+        float tb = (hi[i] - s[i]) * inv;
+        float side = -1.0f;
+        if (ta > tb) { float t = ta; ta = tb; tb = t; side = 1.0f; }
+
+        if (ta > tmin)
+        {
+            tmin = ta;
+            normal = (i == 0)? Vector2{ side, 0.0f } : Vector2{ 0.0f, side };
+        }
+        if (tb < tmax) tmax = tb;
+        if (tmin > tmax) return false;
+    }
+
+    if ((normal.x == 0.0f) && (normal.y == 0.0f)) normal = Negate(Normalize(d));
+
+    impact->time = tmin;
+    impact->normal = normal;
+    impact->point = Add(start, Scale(d, tmin));
+
+    return true;
+}
+
+// Sweep a circle along motion against a rectangle
+// NOTE: Ray cast against the box rounded by the radius: inflated box first, then the corner circle when
+// the entry point falls in a corner region
+RMAPI bool Sweep(Circle circle, Vector2 motion, Aabb box, Impact* impact)
+{
+    Contact contact;
+    if (Collide(circle, box, &contact))
+    {
+        impact->time = 0.0f;
+        impact->normal = Negate(contact.normal);
+        impact->point = contact.point;
+        return true;
+    }
+
+    Impact hit;
+    if (!Raycast(Inflate(box, circle.radius), circle.center, Add(circle.center, motion), &hit)) return false;
+
+    bool outsideX = (hit.point.x < box.min.x) || (hit.point.x > box.max.x);
+    bool outsideY = (hit.point.y < box.min.y) || (hit.point.y > box.max.y);
+
+    if (outsideX && outsideY)
+    {
+        // Ray against the corner circle, solving |center + motion*t - corner| = radius
+        Vector2 corner = { (hit.point.x < box.min.x)? box.min.x : box.max.x, (hit.point.y < box.min.y)? box.min.y : box.max.y };
+        Vector2 m = Subtract(circle.center, corner);
+        float a = Dot(motion, motion);
+        float b = Dot(m, motion);
+        float c = Dot(m, m) - circle.radius * circle.radius;
+        float discriminant = b * b - a * c;
+        if ((discriminant < 0.0f) || (a <= EPSILON)) return false;
+
+        float t = (-b - sqrtf(discriminant)) / a;
+        if ((t < 0.0f) || (t > 1.0f)) return false;
+
+        impact->time = t;
+        impact->normal = Normalize(Subtract(Add(circle.center, Scale(motion, t)), corner));
+        impact->point = corner;
+        return true;
+    }
+
+    impact->time = hit.time;
+    impact->normal = hit.normal;
+    impact->point = Subtract(hit.point, Scale(hit.normal, circle.radius));
+
+    return true;
+}
+
+// Cast a ray against every obstacle, returns the index of the first one hit (-1 if none)
+RMAPI int Raycast(const Obstacles* rects, Vector2 start, Vector2 end, Impact* impact)
+{
+    int best = -1;
+    Impact hit = { 0 };
+    impact->time = 1.0f;
+    int i = 0;
+
+#if defined(MATH_SIMD4)
+    Vector2 d = Subtract(end, start);
+    Vector2 invd = { (fabsf(d.x) >= EPSILON)? 1.0f / d.x : 0.0f, (fabsf(d.y) >= EPSILON)? 1.0f / d.y : 0.0f };
+
+    for (; i + 4 <= rects->count; i += 4)
+    {
+        float4 x0 = Load4(rects->x + i);
+        float4 y0 = Load4(rects->y + i);
+        float4 x1 = Add4(x0, Load4(rects->w + i));
+        float4 y1 = Add4(y0, Load4(rects->h + i));
+
+        // Clip the ray at the closest hit so far, only lanes entered before it need the exact test
+        float limit = (best < 0)? 1.0f : impact->time;
+        if (limit <= 0.0f) return best;
+
+        int mask = MoveMask4(ClipSegment4(x0, y0, x1, y1, start, Scale(d, limit), Scale(invd, 1.0f / limit)));
+
+        for (; mask != 0; mask &= mask - 1)
+        {
+            int id = i + LowestLane4(mask);
+            if (Raycast(GetObstacleBounds(rects, id), start, end, &hit) && ((best < 0) || (hit.time < impact->time)))
+            {
+                *impact = hit;
+                best = id;
+            }
+        }
+    }
+#endif
+
+    for (; i < rects->count; i++)
+    {
+        if (Raycast(GetObstacleBounds(rects, i), start, end, &hit) && ((best < 0) || (hit.time < impact->time)))
+        {
+            *impact = hit;
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+// Sweep count projectiles of the same radius along their motions against the obstacles indexed by grid
+// Writes the earliest impact and obstacle index per projectile (index -1 and time 1 when nothing is hit),
+// returns the number of projectiles that hit something
+// NOTE: Only the first SWEEP_MAX_CANDIDATES obstacles near each path are considered
+RMAPI int Sweep(const Grid* grid, const Obstacles* rects, const Vector2* positions, const Vector2* motions, float radius, int count, Impact* impacts, int* hitIds)
+{
+    int hits = 0;
+    int candidates[SWEEP_MAX_CANDIDATES];
+
+    for (int i = 0; i < count; i++)
+    {
+        Circle circle = { positions[i], radius };
+        Vector2 end = Add(positions[i], motions[i]);
+        int candidateCount = QuerySegment(grid, positions[i], end, radius, candidates, SWEEP_MAX_CANDIDATES);
+
+        Impact earliest = { 1.0f, { 0.0f, 0.0f }, end };
+        int earliestId = -1;
+        Impact impact;
+
+        for (int c = 0; c < candidateCount; c++)
+        {
+            if (Sweep(circle, motions[i], GetObstacleBounds(rects, candidates[c]), &impact) && ((earliestId < 0) || (impact.time < earliest.time)))
+            {
+                earliest = impact;
+                earliestId = candidates[c];
+            }
+        }
+
+        impacts[i] = earliest;
+        hitIds[i] = earliestId;
+        if (earliestId >= 0) hits++;
+    }
+
+    return hits;
+}
@@ -0,0 +1,552 @@
+#include "Ecs.h"
+#include <mutex>
+#include <cstdlib>
+#include <cstring>
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define ECS_CHUNK_HEADER_SIZE 64        // Columns start after the header, cache line aligned
+#define ECS_JOBS_PER_THREAD 4           // Chunk batches per thread for ParallelForEachChunk
+
+#define ENTITY_CREATED 0x1
+#define ENTITY_DESTROYED 0x2
+#define ENTITY_TOUCHED 0x4
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Recorded structural change
+typedef enum {
+    COMMAND_CREATE = 0,
+    COMMAND_DESTROY,
+    COMMAND_ADD,
+    COMMAND_REMOVE
+} EcsCommandType;
+
+// Command header, followed by size bytes of component value for COMMAND_ADD
+typedef struct EcsCommand {
+    Entity entity;
+    uint32_t value;         // Component mask for COMMAND_CREATE, component id otherwise
+    uint16_t type;
+    uint16_t size;
+} EcsCommand;
+
+// Entity slot type
+typedef struct EntityRecord {
+    EcsChunk* chunk;        // NULL when the slot is free
+    int row;
+    uint32_t generation;
+    ComponentMask pending;  // Components the entity ends up with, only valid while ENTITY_TOUCHED
+    uint32_t flags;
+} EntityRecord;
+
+struct EcsWorld {
+    int sizes[ECS_MAX_COMPONENTS];
+    int componentCount;
+
+    EcsArchetype** archetypes;
+    int archetypeCount;
+    int archetypeAlloc;
+
+    EntityRecord* records;
+    uint32_t recordCount;
+    uint32_t recordAlloc;
+    uint32_t* freeIndices;
+    int freeCount;
+    int freeAlloc;
+    uint32_t reservedCount;     // Indices handed out so far, records past recordCount exist after the next apply
+    int entityCount;
+
+    unsigned char* commands;
+    size_t commandSize;
+    size_t commandAlloc;
+    uint32_t* touched;          // Scratch: entities referenced by the commands being applied
+    uint32_t touchedAlloc;
+
+    uint32_t version;           // Incremented whenever a chunk is created or freed
+    std::mutex commandMutex;
+};
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Grow an array to hold at least count elements
+static void* Reserve(void* data, int* alloc, int count, size_t size)
+{
+    if (count <= *alloc) return data;
+
+    int grown = (*alloc < 16)? 16 : *alloc * 2;
+    while (grown < count) grown *= 2;
+    *alloc = grown;
+
+    return realloc(data, grown * size);
+}
+
+static int AlignUp(int value, int alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// Lay out a chunk: the most entities per chunk whose columns, each aligned, fit in ECS_CHUNK_SIZE
+static EcsArchetype* CreateArchetype(EcsWorld* world, ComponentMask mask)
+{
+    EcsArchetype* archetype = (EcsArchetype*)calloc(1, sizeof(EcsArchetype));
+    archetype->mask = mask;
+
+    int rowSize = sizeof(Entity);
+    for (int c = 0; c < ECS_MAX_COMPONENTS; c++)
+    {
+        archetype->offsets[c] = -1;
+        if (mask & COMPONENT_BIT(c))
+        {
+            archetype->sizes[c] = world->sizes[c];
+            rowSize += world->sizes[c];
+        }
+    }
+
+    int capacity = (ECS_CHUNK_SIZE - ECS_CHUNK_HEADER_SIZE) / rowSize;
+    for (; capacity > 1; capacity--)
+    {
+        int offset = AlignUp(ECS_CHUNK_HEADER_SIZE + capacity * (int)sizeof(Entity), ECS_COLUMN_ALIGNMENT);
+        for (int c = 0; c < ECS_MAX_COMPONENTS; c++)
+        {
+            if (mask & COMPONENT_BIT(c)) offset = AlignUp(offset + capacity * archetype->sizes[c], ECS_COLUMN_ALIGNMENT);
+        }
+
+        if (offset <= ECS_CHUNK_SIZE) break;
+    }
+
+    // NOTE: Components bigger than a chunk still get one entity per chunk, in an oversized block
+    int offset = ECS_CHUNK_HEADER_SIZE;
+    archetype->capacity = (capacity < 1)? 1 : capacity;
+    archetype->entitiesOffset = offset;
+    offset = AlignUp(offset + archetype->capacity * (int)sizeof(Entity), ECS_COLUMN_ALIGNMENT);
+
+    for (int c = 0; c < ECS_MAX_COMPONENTS; c++)
+    {
+        if (!(mask & COMPONENT_BIT(c))) continue;
+        archetype->offsets[c] = offset;
+        offset = AlignUp(offset + archetype->capacity * archetype->sizes[c], ECS_COLUMN_ALIGNMENT);
+    }
+
+    world->archetypes = (EcsArchetype**)Reserve(world->archetypes, &world->archetypeAlloc, world->archetypeCount + 1, sizeof(EcsArchetype*));
+    world->archetypes[world->archetypeCount++] = archetype;
+
+    return archetype;
+}
+
+static EcsArchetype* GetArchetype(EcsWorld* world, ComponentMask mask)
+{
+    for (int i = 0; i < world->archetypeCount; i++)
+    {
+        if (world->archetypes[i]->mask == mask) return world->archetypes[i];
+    }
+
+    return CreateArchetype(world, mask);
+}
+
+// Get the size of a chunk block of an archetype
+static size_t ChunkBytes(const EcsArchetype* archetype)
+{
+    int end = ECS_CHUNK_HEADER_SIZE;
+    for (int c = 0; c < ECS_MAX_COMPONENTS; c++)
+    {
+        if (archetype->offsets[c] >= 0) end = archetype->offsets[c] + archetype->capacity * archetype->sizes[c];
+    }
+
+    return (end > ECS_CHUNK_SIZE)? (size_t)end : ECS_CHUNK_SIZE;
+}
+
+// Append an uninitialized row at the end of an archetype
+static EcsChunk* AppendRow(EcsWorld* world, EcsArchetype* archetype, int* row)
+{
+    EcsChunk* chunk = (archetype->chunkCount > 0)? archetype->chunks[archetype->chunkCount - 1] : nullptr;
+
+    if ((chunk == nullptr) || (chunk->count == archetype->capacity))
+    {
+        chunk = (EcsChunk*)malloc(ChunkBytes(archetype));
+        chunk->archetype = archetype;
+        chunk->count = 0;
+
+        archetype->chunks = (EcsChunk**)Reserve(archetype->chunks, &archetype->chunkAlloc, archetype->chunkCount + 1, sizeof(EcsChunk*));
+        archetype->chunks[archetype->chunkCount++] = chunk;
+        world->version++;
+    }
+
+    *row = chunk->count++;
+    archetype->entityCount++;
+
+    return chunk;
+}
+
+// Remove a row by moving the archetype's last row into it
+static void RemoveRow(EcsWorld* world, EcsChunk* chunk, int row)
+{
+    EcsArchetype* archetype = chunk->archetype;
+    EcsChunk* last = archetype->chunks[archetype->chunkCount - 1];
+    int lastRow = last->count - 1;
+
+    if ((last != chunk) || (lastRow != row))
+    {
+        Entity moved = GetChunkEntities(last)[lastRow];
+        GetChunkEntities(chunk)[row] = moved;
+
+        for (int c = 0; c < ECS_MAX_COMPONENTS; c++)
+        {
+            int offset = archetype->offsets[c];
+            int size = archetype->sizes[c];
+            if (offset >= 0) memcpy((unsigned char*)chunk + offset + row * size, (unsigned char*)last + offset + lastRow * size, size);
+        }
+
+        world->records[moved.index].chunk = chunk;
+        world->records[moved.index].row = row;
+    }
+
+    last->count--;
+    archetype->entityCount--;
+
+    // NOTE: The first chunk is kept even when empty, archetypes are rarely emptied for good
+    if ((last->count == 0) && (archetype->chunkCount > 1))
+    {
+        free(last);
+        archetype->chunkCount--;
+        world->version++;
+    }
+}
+
+// Move an entity into the archetype for mask, keeping the components both archetypes share
+static void MoveEntity(EcsWorld* world, uint32_t index, ComponentMask mask)
+{
+    EntityRecord* record = &world->records[index];
+    EcsArchetype* target = GetArchetype(world, mask);
+
+    int row = 0;
+    EcsChunk* chunk = AppendRow(world, target, &row);
+    GetChunkEntities(chunk)[row] = Entity{ index, record->generation };
+
+    for (int c = 0; c < ECS_MAX_COMPONENTS; c++)
+    {
+        int offset = target->offsets[c];
+        if (offset < 0) continue;
+
+        int size = target->sizes[c];
+        unsigned char* destination = (unsigned char*)chunk + offset + row * size;
+        void* source = (record->chunk != nullptr)? GetChunkColumn(record->chunk, c) : nullptr;
+
+        if (source != nullptr) memcpy(destination, (unsigned char*)source + record->row * size, size);
+        else memset(destination, 0, size);
+    }
+
+    if (record->chunk != nullptr) RemoveRow(world, record->chunk, record->row);
+
+    // NOTE: RemoveRow may have moved rows around, but never the one just appended to another archetype
+    record->chunk = chunk;
+    record->row = row;
+}
+
+// Append a command to the buffer, commandMutex must be held
+static void PushCommand(EcsWorld* world, EcsCommandType type, Entity entity, uint32_t value, const void* data, int size)
+{
+    size_t needed = world->commandSize + sizeof(EcsCommand) + size;
+    if (needed > world->commandAlloc)
+    {
+        world->commandAlloc = (world->commandAlloc < 4096)? 4096 : world->commandAlloc;
+        while (world->commandAlloc < needed) world->commandAlloc *= 2;
+        world->commands = (unsigned char*)realloc(world->commands, world->commandAlloc);
+    }
+
+    EcsCommand command = { entity, value, (uint16_t)type, (uint16_t)size };
+    memcpy(world->commands + world->commandSize, &command, sizeof(EcsCommand));
+    if (size > 0)
+    {
+        if (data != nullptr) memcpy(world->commands + world->commandSize + sizeof(EcsCommand), data, size);
+        else memset(world->commands + world->commandSize + sizeof(EcsCommand), 0, size);
+    }
+
+    world->commandSize = needed;
+}
+
+// Check if a command still refers to the entity it was recorded for
+static bool CommandTarget(const EcsWorld* world, Entity entity)
+{
+    if (entity.index >= world->recordCount) return false;
+
+    const EntityRecord* record = &world->records[entity.index];
+    return (record->generation == entity.generation) && ((record->chunk != nullptr) || (record->flags & ENTITY_CREATED)) && !(record->flags & ENTITY_DESTROYED);
+}
+
+// Job: run the query callback on chunks [begin, end)
+static void RunQueryChunks(void* context, int begin, int end)
+{
+    EcsQuery* query = (EcsQuery*)context;
+    for (int i = begin; i < end; i++)
+    {
+        if (query->chunks[i]->count > 0) query->function(query->context, query->chunks[i]);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - World
+//----------------------------------------------------------------------------------
+
+EcsWorld* LoadEcsWorld(void)
+{
+    EcsWorld* world = new EcsWorld();
+
+    RegisterComponent(world, sizeof(TransformComponent));
+    RegisterComponent(world, sizeof(VelocityComponent));
+    RegisterComponent(world, sizeof(ColliderComponent));
+
+    return world;
+}
+
+void UnloadEcsWorld(EcsWorld* world)
+{
+    if (world == nullptr) return;
+
+    for (int i = 0; i < world->archetypeCount; i++)
+    {
+        EcsArchetype* archetype = world->archetypes[i];
+        for (int k = 0; k < archetype->chunkCount; k++) free(archetype->chunks[k]);
+        free(archetype->chunks);
+        free(archetype);
+    }
+
+    free(world->archetypes);
+    free(world->records);
+    free(world->freeIndices);
+    free(world->commands);
+    free(world->touched);
+
+    delete world;
+}
+
+int RegisterComponent(EcsWorld* world, int size)
+{
+    if ((world->componentCount == ECS_MAX_COMPONENTS) || (size <= 0) || (size > UINT16_MAX)) return -1;
+
+    world->sizes[world->componentCount] = size;
+    return world->componentCount++;
+}
+
+int GetEntityCount(const EcsWorld* world)
+{
+    return world->entityCount;
+}
+
+bool IsEntityAlive(const EcsWorld* world, Entity entity)
+{
+    return (entity.index < world->recordCount) && (world->records[entity.index].chunk != nullptr) &&
+        (world->records[entity.index].generation == entity.generation);
+}
+
+void* GetComponent(EcsWorld* world, Entity entity, int component)
+{
+    if (!IsEntityAlive(world, entity)) return nullptr;
+
+    const EntityRecord* record = &world->records[entity.index];
+    unsigned char* column = (unsigned char*)GetChunkColumn(record->chunk, component);
+
+    return (column == nullptr)? nullptr : column + record->row * world->sizes[component];
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Structural changes
+//----------------------------------------------------------------------------------
+
+Entity CreateEntity(EcsWorld* world, ComponentMask components)
+{
+    std::lock_guard<std::mutex> lock(world->commandMutex);
+
+    // Reuse a freed slot, its record already holds the next generation
+    Entity entity = { 0 };
+    if (world->freeCount > 0) entity.index = world->freeIndices[--world->freeCount];
+    else entity.index = world->reservedCount++;
+    entity.generation = (entity.index < world->recordCount)? world->records[entity.index].generation : 1;
+
+    PushCommand(world, COMMAND_CREATE, entity, components, nullptr, 0);
+
+    return entity;
+}
+
+void DestroyEntity(EcsWorld* world, Entity entity)
+{
+    std::lock_guard<std::mutex> lock(world->commandMutex);
+    PushCommand(world, COMMAND_DESTROY, entity, 0, nullptr, 0);
+}
+
+void AddComponent(EcsWorld* world, Entity entity, int component, const void* value)
+{
+    if ((component < 0) || (component >= world->componentCount)) return;
+
+    std::lock_guard<std::mutex> lock(world->commandMutex);
+    PushCommand(world, COMMAND_ADD, entity, (uint32_t)component, value, world->sizes[component]);
+}
+
+void RemoveComponent(EcsWorld* world, Entity entity, int component)
+{
+    if ((component < 0) || (component >= world->componentCount)) return;
+
+    std::lock_guard<std::mutex> lock(world->commandMutex);
+    PushCommand(world, COMMAND_REMOVE, entity, (uint32_t)component, nullptr, 0);
+}
+
+void ApplyEntityCommands(EcsWorld* world)
+{
+    if (world->commandSize == 0) return;
+
+    // Records for the indices reserved since the last apply
+    if (world->reservedCount > world->recordCount)
+    {
+        int alloc = (int)world->recordAlloc;
+        world->records = (EntityRecord*)Reserve(world->records, &alloc, (int)world->reservedCount, sizeof(EntityRecord));
+        world->recordAlloc = (uint32_t)alloc;
+
+        for (uint32_t i = world->recordCount; i < world->reservedCount; i++) world->records[i] = EntityRecord{ nullptr, 0, 1, 0, 0 };
+        world->recordCount = world->reservedCount;
+    }
+
+    // Pass 1: fold every command into the final component set of its entity
+    uint32_t touchedCount = 0;
+    for (size_t at = 0; at < world->commandSize; )
+    {
+        EcsCommand command;
+        memcpy(&command, world->commands + at, sizeof(EcsCommand));
+        at += sizeof(EcsCommand) + command.size;
+
+        if (command.entity.index >= world->recordCount) continue;
+        EntityRecord* record = &world->records[command.entity.index];
+
+        if (command.type == COMMAND_CREATE)
+        {
+            if ((record->generation != command.entity.generation) || (record->chunk != nullptr)) continue;
+            record->flags |= ENTITY_CREATED;
+            record->pending = command.value;
+        }
+        else if (!CommandTarget(world, command.entity)) continue;
+
+        if (!(record->flags & ENTITY_TOUCHED))
+        {
+            if (!(record->flags & ENTITY_CREATED)) record->pending = record->chunk->archetype->mask;
+            record->flags |= ENTITY_TOUCHED;
+
+            int alloc = (int)world->touchedAlloc;
+            world->touched = (uint32_t*)Reserve(world->touched, &alloc, (int)touchedCount + 1, sizeof(uint32_t));
+            world->touchedAlloc = (uint32_t)alloc;
+            world->touched[touchedCount++] = command.entity.index;
+        }
+
+        if (command.type == COMMAND_DESTROY) record->flags |= ENTITY_DESTROYED;
+        else if (command.type == COMMAND_ADD) record->pending |= COMPONENT_BIT(command.value);
+        else if (command.type == COMMAND_REMOVE) record->pending &= ~COMPONENT_BIT(command.value);
+    }
+
+    // Pass 2: move every entity once, to its final archetype
+    for (uint32_t i = 0; i < touchedCount; i++)
+    {
+        uint32_t index = world->touched[i];
+        EntityRecord* record = &world->records[index];
+
+        if (record->flags & ENTITY_DESTROYED)
+        {
+            if (record->chunk != nullptr)
+            {
+                RemoveRow(world, record->chunk, record->row);
+                world->entityCount--;
+            }
+
+            record->chunk = nullptr;
+            record->generation = (record->generation == UINT32_MAX)? 1 : record->generation + 1;
+
+            world->freeIndices = (uint32_t*)Reserve(world->freeIndices, &world->freeAlloc, world->freeCount + 1, sizeof(uint32_t));
+            world->freeIndices[world->freeCount++] = index;
+        }
+        else if (record->chunk == nullptr)
+        {
+            MoveEntity(world, index, record->pending);
+            world->entityCount++;
+        }
+        else if (record->pending != record->chunk->archetype->mask) MoveEntity(world, index, record->pending);
+    }
+
+    // Pass 3: write component values into their final place
+    for (size_t at = 0; at < world->commandSize; )
+    {
+        EcsCommand command;
+        memcpy(&command, world->commands + at, sizeof(EcsCommand));
+        const unsigned char* value = world->commands + at + sizeof(EcsCommand);
+        at += sizeof(EcsCommand) + command.size;
+
+        if (command.type != COMMAND_ADD) continue;
+
+        void* component = GetComponent(world, command.entity, (int)command.value);
+        if (component != nullptr) memcpy(component, value, command.size);
+    }
+
+    for (uint32_t i = 0; i < touchedCount; i++) world->records[world->touched[i]].flags = 0;
+
+    // NOTE: Creations that never got applied (stale generation) simply leave their index unused until reserved again
+    world->commandSize = 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Queries
+//----------------------------------------------------------------------------------
+
+EcsQuery LoadQuery(ComponentMask all, ComponentMask none)
+{
+    EcsQuery query = { 0 };
+    query.all = all;
+    query.none = none;
+    query.version = UINT32_MAX;
+
+    return query;
+}
+
+void UnloadQuery(EcsQuery query)
+{
+    free(query.chunks);
+}
+
+int UpdateQuery(EcsWorld* world, EcsQuery* query)
+{
+    if (query->version == world->version) return query->chunkCount;
+
+    query->chunkCount = 0;
+    for (int i = 0; i < world->archetypeCount; i++)
+    {
+        EcsArchetype* archetype = world->archetypes[i];
+        if (((archetype->mask & query->all) != query->all) || (archetype->mask & query->none)) continue;
+
+        query->chunks = (EcsChunk**)Reserve(query->chunks, &query->chunkAlloc, query->chunkCount + archetype->chunkCount, sizeof(EcsChunk*));
+        for (int k = 0; k < archetype->chunkCount; k++) query->chunks[query->chunkCount++] = archetype->chunks[k];
+    }
+
+    query->version = world->version;
+
+    return query->chunkCount;
+}
+
+void ForEachChunk(EcsWorld* world, EcsQuery* query, EcsChunkFunction function, void* context)
+{
+    UpdateQuery(world, query);
+
+    for (int i = 0; i < query->chunkCount; i++)
+    {
+        if (query->chunks[i]->count > 0) function(context, query->chunks[i]);
+    }
+}
+
+void ParallelForEachChunk(EcsWorld* world, EcsQuery* query, EcsChunkFunction function, void* context, JobCounter* counter)
+{
+    int count = UpdateQuery(world, query);
+    int batchSize = count / ((GetWorkerCount() + 1) * ECS_JOBS_PER_THREAD);
+
+    query->function = function;
+    query->context = context;
+
+    ParallelFor(count, (batchSize < 1)? 1 : batchSize, RunQueryChunks, query, counter);
+}
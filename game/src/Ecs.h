@@ -0,0 +1,175 @@
+#pragma once
+#include "Math.h"
+#include "JobSystem.h"
+
+// Archetype based entity component system.
+// Entities with the same set of components share an archetype, whose storage is a list of fixed size chunks.
+// Inside a chunk every component is a tightly packed column (structure of arrays), so a system walking a
+// query touches contiguous memory only. Removing an entity moves the archetype's last entity into the hole,
+// chunks stay packed and only the last one is ever partially filled.
+// Structural changes (create, destroy, add/remove component) are recorded and applied together by
+// ApplyEntityCommands at the end of the frame, until then chunk layouts never change under a running system.
+// NOTE: Recording commands is thread-safe, jobs may create and destroy entities while iterating a query
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define ECS_MAX_COMPONENTS 32
+#define ECS_CHUNK_SIZE (16*1024)        // Bytes per chunk, header included
+#define ECS_COLUMN_ALIGNMENT 16
+
+#define COMPONENT_BIT(component) (1u << (component))
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Built-in component ids, RegisterComponent hands out the following ones
+typedef enum {
+    COMPONENT_TRANSFORM = 0,
+    COMPONENT_VELOCITY,
+    COMPONENT_COLLIDER,
+    COMPONENT_BUILTIN_COUNT
+} ComponentId;
+
+// Collider shapes
+typedef enum {
+    COLLIDER_SPHERE = 0,    // Radius in extents.x
+    COLLIDER_BOX            // Half size per axis in extents
+} ColliderShape;
+
+typedef uint32_t ComponentMask;
+
+// Entity handle type, stale once the entity is destroyed (generation mismatch)
+typedef struct Entity {
+    uint32_t index;
+    uint32_t generation;    // Never zero for a handle returned by CreateEntity
+} Entity;
+
+// Transform component
+typedef struct TransformComponent {
+    Vector3 translation;
+    Quaternion rotation;
+} TransformComponent;
+
+// Velocity component
+typedef struct VelocityComponent {
+    Vector3 linear;
+    Vector3 angular;        // Axis scaled by radians per second
+} VelocityComponent;
+
+// Collider component
+typedef struct ColliderComponent {
+    Vector3 extents;
+    int shape;              // ColliderShape
+    uint32_t layers;        // Layer bits the collider belongs to
+} ColliderComponent;
+
+// Archetype type, storage for every entity with exactly this set of components
+typedef struct EcsArchetype {
+    ComponentMask mask;
+    int capacity;                           // Entities per chunk
+    int entitiesOffset;                     // Byte offset of the Entity column in a chunk
+    int offsets[ECS_MAX_COMPONENTS];        // Byte offset of each component column, -1 when absent
+    int sizes[ECS_MAX_COMPONENTS];
+    struct EcsChunk** chunks;               // All full except the last one
+    int chunkCount;
+    int chunkAlloc;
+    int entityCount;
+} EcsArchetype;
+
+// Chunk type, header of an ECS_CHUNK_SIZE block holding the component columns
+typedef struct EcsChunk {
+    EcsArchetype* archetype;
+    int count;
+} EcsChunk;
+
+// Opaque world type, owns entities, archetypes and the pending command buffer
+typedef struct EcsWorld EcsWorld;
+
+// Query chunk callback
+typedef void (*EcsChunkFunction)(void* context, EcsChunk* chunk);
+
+// Query type, caches the matching chunks between structural changes
+typedef struct EcsQuery {
+    ComponentMask all;              // Components an archetype must have
+    ComponentMask none;             // Components an archetype must not have
+    EcsChunk** chunks;
+    int chunkCount;
+    int chunkAlloc;
+    uint32_t version;               // World layout version the cache was built for
+    EcsChunkFunction function;      // Callback of the running ParallelForEachChunk
+    void* context;
+} EcsQuery;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+// Create an empty world with the built-in components registered
+EcsWorld* LoadEcsWorld(void);
+
+// Free the world, its entities and pending commands
+void UnloadEcsWorld(EcsWorld* world);
+
+// Register a component type of size bytes, returns its id or -1 when ECS_MAX_COMPONENTS are in use
+int RegisterComponent(EcsWorld* world, int size);
+
+// Get the number of live entities (as of the last ApplyEntityCommands)
+int GetEntityCount(const EcsWorld* world);
+
+// Check if an entity handle refers to a live entity
+bool IsEntityAlive(const EcsWorld* world, Entity entity);
+
+// Get a pointer to an entity's component, NULL if missing
+// NOTE: Pointers are invalidated by the next ApplyEntityCommands
+void* GetComponent(EcsWorld* world, Entity entity, int component);
+
+// Record an entity creation with the given (zero-initialized) components, the handle is valid right away
+Entity CreateEntity(EcsWorld* world, ComponentMask components);
+
+// Record an entity destruction
+void DestroyEntity(EcsWorld* world, Entity entity);
+
+// Record adding a component, value (optional, zero when NULL) is copied, existing components are overwritten
+void AddComponent(EcsWorld* world, Entity entity, int component, const void* value);
+
+// Record removing a component
+void RemoveComponent(EcsWorld* world, Entity entity, int component);
+
+// Apply every recorded change, each entity moves between archetypes at most once
+// NOTE: Call from one thread with no system running, usually at the end of the frame
+void ApplyEntityCommands(EcsWorld* world);
+
+// Create a query over archetypes having every component in all and none in none
+EcsQuery LoadQuery(ComponentMask all, ComponentMask none);
+
+// Free the query chunk cache
+void UnloadQuery(EcsQuery query);
+
+// Refresh the query chunk list if the world layout changed, returns the number of chunks
+int UpdateQuery(EcsWorld* world, EcsQuery* query);
+
+// Run function on every chunk matching the query, on the calling thread
+void ForEachChunk(EcsWorld* world, EcsQuery* query, EcsChunkFunction function, void* context);
+
+// Run function on every chunk matching the query, spread over the job system
+// NOTE: The query is in use until counter reaches zero, don't update or dispatch it again before that
+void ParallelForEachChunk(EcsWorld* world, EcsQuery* query, EcsChunkFunction function, void* context, JobCounter* counter);
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Chunk access
+//----------------------------------------------------------------------------------
+
+// Get the packed array of a component in a chunk, NULL if the archetype doesn't have it
+inline void* GetChunkColumn(EcsChunk* chunk, int component)
+{
+    int offset = chunk->archetype->offsets[component];
+    return (offset < 0)? nullptr : (unsigned char*)chunk + offset;
+}
+
+// Get the packed array of entity handles in a chunk
+inline Entity* GetChunkEntities(EcsChunk* chunk)
+{
+    return (Entity*)((unsigned char*)chunk + chunk->archetype->entitiesOffset);
+}
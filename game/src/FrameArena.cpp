@@ -0,0 +1,167 @@
+#include "FrameArena.h"
+#include "AlignedAlloc.h"
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define FRAME_BUFFER_ALIGNMENT 64       // Buffers start on a cache line
+#define FRAME_FORMAT_GUESS 128          // First attempt size for FrameFormat
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Allocate from the heap and chain the block to the current buffer, released with it
+static void* OverflowAlloc(FrameArena* arena, size_t size, size_t alignment)
+{
+    size_t header = (sizeof(FrameOverflow) + alignment - 1) & ~(alignment - 1);
+    FrameOverflow* block = (FrameOverflow*)AlignedAlloc(header + size, (alignment > alignof(FrameOverflow))? alignment : alignof(FrameOverflow));
+    if (block == nullptr) return nullptr;
+
+    block->size = size;
+
+    std::atomic_ref<FrameOverflow*> head(arena->overflows[arena->current]);
+    block->next = head.load(std::memory_order_relaxed);
+    while (!head.compare_exchange_weak(block->next, block, std::memory_order_release, std::memory_order_relaxed)) {}
+
+    std::atomic_ref<size_t>(arena->overflowBytes[arena->current]).fetch_add(size, std::memory_order_relaxed);
+
+    return (unsigned char*)block + header;
+}
+
+// Release everything a buffer holds
+static void ResetBuffer(FrameArena* arena, int buffer)
+{
+#if defined(FRAME_ARENA_DEBUG)
+    memset(arena->buffers[buffer], FRAME_ARENA_RELEASED_BYTE, (arena->offsets[buffer] < arena->capacity)? arena->offsets[buffer] : arena->capacity);
+#endif
+
+    FrameOverflow* block = arena->overflows[buffer];
+    while (block != nullptr)
+    {
+        FrameOverflow* next = block->next;
+        AlignedFree(block);
+        block = next;
+    }
+
+    arena->offsets[buffer] = 0;
+    arena->overflows[buffer] = nullptr;
+    arena->overflowBytes[buffer] = 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+FrameArena LoadFrameArena(size_t capacity)
+{
+    FrameArena arena = { 0 };
+    arena.capacity = capacity;
+
+    for (int i = 0; i < 2; i++)
+    {
+        arena.buffers[i] = (unsigned char*)AlignedAlloc((capacity > 0)? capacity : 1, FRAME_BUFFER_ALIGNMENT);
+#if defined(FRAME_ARENA_DEBUG)
+        memset(arena.buffers[i], FRAME_ARENA_RELEASED_BYTE, capacity);
+#endif
+    }
+
+    return arena;
+}
+
+void UnloadFrameArena(FrameArena arena)
+{
+    for (int i = 0; i < 2; i++)
+    {
+        ResetBuffer(&arena, i);
+        AlignedFree(arena.buffers[i]);
+    }
+}
+
+void BeginArenaFrame(FrameArena* arena)
+{
+    int current = arena->current;
+    size_t offset = (arena->offsets[current] < arena->capacity)? arena->offsets[current] : arena->capacity;
+    size_t used = offset + arena->overflowBytes[current];
+
+    arena->lastFrameUsed = used;
+    if (used > arena->peakUsed)
+    {
+        arena->peakUsed = used;
+
+        // Overflowing frames are reported once per new peak, not every frame
+        if (arena->overflowBytes[current] > 0) fprintf(stderr, "WARNING: FRAME: Arena of %zu bytes overflowed by %zu bytes on frame %llu, falling back to the heap\n",
+            arena->capacity, arena->overflowBytes[current], (unsigned long long)arena->frame);
+#if defined(FRAME_ARENA_DEBUG)
+        if (arena->frame > 0) printf("INFO: FRAME: New arena peak %zu bytes (%.1f%% of %zu) on frame %llu\n", used,
+            100.0 * used / (double)arena->capacity, arena->capacity, (unsigned long long)arena->frame);
+#endif
+    }
+
+    // The previous frame's buffer stays readable, the one before it is recycled
+    arena->current = 1 - current;
+    ResetBuffer(arena, arena->current);
+    arena->frame++;
+}
+
+void* FrameAlloc(FrameArena* arena, size_t size, size_t alignment)
+{
+    int current = arena->current;
+    std::atomic_ref<size_t> offset(arena->offsets[current]);
+
+    // Bump the offset to the aligned end of the allocation, so it only counts the padding actually used
+    size_t start = offset.load(std::memory_order_relaxed);
+    size_t aligned = 0;
+    do
+    {
+        aligned = (start + alignment - 1) & ~(alignment - 1);
+        if (aligned + size > arena->capacity) return OverflowAlloc(arena, (size > 0)? size : 1, alignment);
+    } while (!offset.compare_exchange_weak(start, aligned + size, std::memory_order_relaxed));
+
+    void* ptr = arena->buffers[current] + aligned;
+#if defined(FRAME_ARENA_DEBUG)
+    memset(ptr, FRAME_ARENA_FRESH_BYTE, size);
+#endif
+
+    return ptr;
+}
+
+const char* FrameFormat(FrameArena* arena, const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+
+    char* text = (char*)FrameAlloc(arena, FRAME_FORMAT_GUESS, 1);
+    int length = vsnprintf(text, FRAME_FORMAT_GUESS, format, args);
+    va_end(args);
+
+    if (length >= FRAME_FORMAT_GUESS)
+    {
+        // Too long for the first guess, format again into a buffer of the right size
+        text = (char*)FrameAlloc(arena, (size_t)length + 1, 1);
+        va_start(args, format);
+        vsnprintf(text, (size_t)length + 1, format, args);
+        va_end(args);
+    }
+
+    return (length < 0)? "" : text;
+}
+
+FrameArenaStats GetFrameArenaStats(const FrameArena* arena)
+{
+    FrameArenaStats stats = { 0 };
+    size_t offset = arena->offsets[arena->current];
+
+    stats.capacity = arena->capacity;
+    stats.overflowBytes = arena->overflowBytes[arena->current];
+    stats.used = ((offset < arena->capacity)? offset : arena->capacity) + stats.overflowBytes;
+    stats.lastFrameUsed = arena->lastFrameUsed;
+    stats.peakUsed = arena->peakUsed;
+
+    return stats;
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Double-buffered frame arena for transient per-frame data.
+// Allocations bump an offset in the current buffer and are never freed one by one, BeginArenaFrame
+// switches to the other buffer and rewinds it. Memory allocated in frame N stays valid through frame N+1,
+// so a renderer (or render thread) can read the previous frame's data while the next one is being built.
+// When a buffer runs out, allocations fall back to the heap (warned about once per new usage peak) and are released with the buffer,
+// raise the capacity until GetFrameArenaStats reports no overflow.
+// NOTE: FrameAlloc is thread-safe (lock-free bump of the offset), BeginArenaFrame must not race with allocations
+// NOTE: FRAME_ARENA_DEBUG (on in Debug builds) poisons released and fresh memory to catch stale reads
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#if defined(DEBUG) && !defined(FRAME_ARENA_DEBUG)
+#define FRAME_ARENA_DEBUG
+#endif
+
+#define FRAME_ARENA_ALIGNMENT 16            // Default allocation alignment
+#define FRAME_ARENA_FRESH_BYTE 0xCD         // Debug fill of newly allocated memory
+#define FRAME_ARENA_RELEASED_BYTE 0xDD      // Debug fill of memory released by BeginArenaFrame
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Heap block used once a buffer is full, chained per buffer
+typedef struct FrameOverflow {
+    struct FrameOverflow* next;
+    size_t size;
+} FrameOverflow;
+
+// Frame arena type
+typedef struct FrameArena {
+    unsigned char* buffers[2];
+    size_t capacity;                // Bytes per buffer
+    size_t offsets[2];              // Bytes used in each buffer
+    FrameOverflow* overflows[2];
+    size_t overflowBytes[2];
+    int current;                    // Buffer allocations go to
+    uint64_t frame;
+    size_t lastFrameUsed;           // Bytes (arena + overflow) used by the previous frame
+    size_t peakUsed;                // Highest lastFrameUsed seen
+} FrameArena;
+
+// Frame arena statistics
+typedef struct FrameArenaStats {
+    size_t capacity;
+    size_t used;                    // Current frame so far
+    size_t lastFrameUsed;
+    size_t peakUsed;
+    size_t overflowBytes;           // Current frame bytes that didn't fit in the buffer
+} FrameArenaStats;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+// Create an arena with two buffers of capacity bytes each
+FrameArena LoadFrameArena(size_t capacity);
+
+// Free the arena buffers and any overflow blocks
+void UnloadFrameArena(FrameArena arena);
+
+// Start a new frame: switch buffers and release what the frame before last allocated
+void BeginArenaFrame(FrameArena* arena);
+
+// Allocate size bytes for the current frame, alignment must be a power of two
+void* FrameAlloc(FrameArena* arena, size_t size, size_t alignment = FRAME_ARENA_ALIGNMENT);
+
+// Format a string into frame memory (printf style), valid until the frame after next
+const char* FrameFormat(FrameArena* arena, const char* format, ...);
+
+// Get arena usage statistics
+FrameArenaStats GetFrameArenaStats(const FrameArena* arena);
+
+//----------------------------------------------------------------------------------
+// STL allocator adapters
+//----------------------------------------------------------------------------------
+
+// Standard allocator drawing from a frame arena, deallocate is a no-op
+// NOTE: Containers using it must not outlive the frame after the one they were filled in
+template <typename T>
+struct FrameAllocator {
+    typedef T value_type;
+
+    FrameArena* arena;
+
+    FrameAllocator(FrameArena* arena) noexcept : arena(arena) {}
+
+    template <typename U>
+    FrameAllocator(const FrameAllocator<U>& other) noexcept : arena(other.arena) {}
+
+    T* allocate(size_t n)
+    {
+        return (T*)FrameAlloc(arena, n * sizeof(T), (alignof(T) > FRAME_ARENA_ALIGNMENT)? alignof(T) : FRAME_ARENA_ALIGNMENT);
+    }
+
+    void deallocate(T*, size_t) noexcept {}
+
+    template <typename U>
+    bool operator==(const FrameAllocator<U>& other) const noexcept { return arena == other.arena; }
+
+    template <typename U>
+    bool operator!=(const FrameAllocator<U>& other) const noexcept { return arena != other.arena; }
+};
+
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+typedef std::basic_string<char, std::char_traits<char>, FrameAllocator<char>> FrameString;
@@ -0,0 +1,260 @@
+#include "Grid.h"
+#include <cstdlib>
+#include <cstring>
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define GRID_CELLS_PER_OBSTACLE 4       // Upper bound on cell count relative to obstacle count
+#define GRID_CELL_MARGIN 1e-3f          // Extra reach when picking cells, absorbs rounding at cell borders
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Get the column (axis 0) or row (axis 1) containing coordinate v, clamped to the grid
+static int CellCoord(const Grid* grid, float v, int axis)
+{
+    float origin = (axis == 0)? grid->origin.x : grid->origin.y;
+    int last = ((axis == 0)? grid->columns : grid->rows) - 1;
+    float cell = (v - origin) * grid->invCellSize;
+
+    // NOTE: Truncation equals floor once negative coordinates are clamped, and avoids a floorf call per lookup
+    if (cell < 0.0f) return 0;
+    if (cell > (float)last) return last;
+    return (int)cell;
+}
+
+// Get the inclusive cell range covered by a box
+static void CellRange(const Grid* grid, Aabb box, int* x0, int* y0, int* x1, int* y1)
+{
+    *x0 = CellCoord(grid, box.min.x, 0);
+    *y0 = CellCoord(grid, box.min.y, 1);
+    *x1 = CellCoord(grid, box.max.x, 0);
+    *y1 = CellCoord(grid, box.max.y, 1);
+}
+
+// Check if id was already written to out
+static bool Reported(const int* out, int count, int id)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (out[i] == id) return true;
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+Grid LoadGrid(const Obstacles* obstacles, float cellSize)
+{
+    Grid grid = { 0 };
+    grid.count = obstacles->count;
+
+    Aabb world = (obstacles->count > 0)? obstacles->bounds : Aabb{ { 0.0f, 0.0f }, { 1.0f, 1.0f } };
+    float averageSize = 0.0f;
+
+    for (int i = 0; i < obstacles->count; i++) averageSize += (obstacles->w[i] > obstacles->h[i])? obstacles->w[i] : obstacles->h[i];
+
+    // Default cells are twice the average obstacle size, so most obstacles land in one to four cells
+    if (cellSize <= 0.0f) cellSize = (obstacles->count > 0)? 2.0f * averageSize / obstacles->count : 1.0f;
+    if (cellSize <= 0.0f) cellSize = 1.0f;
+
+    Vector2 extent = Subtract(world.max, world.min);
+    long long maxCells = (long long)GRID_CELLS_PER_OBSTACLE * obstacles->count + 1;
+    while ((long long)ceilf(extent.x / cellSize) * (long long)ceilf(extent.y / cellSize) > maxCells) cellSize *= 1.5f;
+
+    grid.origin = world.min;
+    grid.cellSize = cellSize;
+    grid.invCellSize = 1.0f / cellSize;
+    grid.columns = (int)fmaxf(1.0f, ceilf(extent.x / cellSize));
+    grid.rows = (int)fmaxf(1.0f, ceilf(extent.y / cellSize));
+
+    int cellCount = grid.columns * grid.rows;
+    grid.cellStart = (int*)calloc(cellCount + 1, sizeof(int));
+
+    // Pass 1: count entries per cell, stored one slot ahead so the prefix sum yields start offsets
+    for (int i = 0; i < obstacles->count; i++)
+    {
+        int x0, y0, x1, y1;
+        CellRange(&grid, GetObstacleBounds(obstacles, i), &x0, &y0, &x1, &y1);
+
+        for (int y = y0; y <= y1; y++)
+        {
+            for (int x = x0; x <= x1; x++) grid.cellStart[y * grid.columns + x + 1]++;
+        }
+    }
+
+    for (int c = 0; c < cellCount; c++) grid.cellStart[c + 1] += grid.cellStart[c];
+
+    grid.entryCount = grid.cellStart[cellCount];
+    grid.entries = (GridEntry*)malloc((grid.entryCount > 0? grid.entryCount : 1) * sizeof(GridEntry));
+
+    // Pass 2: scatter entries into their cells
+    int* cursor = (int*)malloc(cellCount * sizeof(int));
+    memcpy(cursor, grid.cellStart, cellCount * sizeof(int));
+
+    for (int i = 0; i < obstacles->count; i++)
+    {
+        Aabb box = GetObstacleBounds(obstacles, i);
+        int x0, y0, x1, y1;
+        CellRange(&grid, box, &x0, &y0, &x1, &y1);
+
+        for (int y = y0; y <= y1; y++)
+        {
+            for (int x = x0; x <= x1; x++)
+            {
+                GridEntry entry = { box, i };
+                grid.entries[cursor[y * grid.columns + x]++] = entry;
+            }
+        }
+    }
+
+    free(cursor);
+
+    return grid;
+}
+
+void UnloadGrid(Grid grid)
+{
+    free(grid.cellStart);
+    free(grid.entries);
+}
+
+int QueryPoint(const Grid* grid, Vector2 point, int* out, int maxOut)
+{
+    int count = 0;
+    int cell = CellCoord(grid, point.y, 1) * grid->columns + CellCoord(grid, point.x, 0);
+
+    for (int e = grid->cellStart[cell]; (e < grid->cellStart[cell + 1]) && (count < maxOut); e++)
+    {
+        if (Contains(grid->entries[e].bounds, point)) out[count++] = grid->entries[e].id;
+    }
+
+    return count;
+}
+
+int QueryCircle(const Grid* grid, Vector2 center, float radius, int* out, int maxOut)
+{
+    int count = 0;
+    float radiusSqr = radius * radius;
+    int qx0, qy0, qx1, qy1;
+    CellRange(grid, Inflate(Aabb{ center, center }, radius), &qx0, &qy0, &qx1, &qy1);
+
+    for (int y = qy0; y <= qy1; y++)
+    {
+        for (int x = qx0; x <= qx1; x++)
+        {
+            int cell = y * grid->columns + x;
+
+            for (int e = grid->cellStart[cell]; e < grid->cellStart[cell + 1]; e++)
+            {
+                const GridEntry* entry = &grid->entries[e];
+                if (DistanceSqr(entry->bounds, center) > radiusSqr) continue;
+
+                // An obstacle spanning several cells is reported from the first cell shared with the query
+                int x0, y0, x1, y1;
+                CellRange(grid, entry->bounds, &x0, &y0, &x1, &y1);
+                if ((x != ((x0 > qx0)? x0 : qx0)) || (y != ((y0 > qy0)? y0 : qy0))) continue;
+
+                if (count >= maxOut) return count;
+                out[count++] = entry->id;
+            }
+        }
+    }
+
+    return count;
+}
+
+int QueryRect(const Grid* grid, Aabb rect, int* out, int maxOut)
+{
+    int count = 0;
+    int qx0, qy0, qx1, qy1;
+    CellRange(grid, rect, &qx0, &qy0, &qx1, &qy1);
+
+    for (int y = qy0; y <= qy1; y++)
+    {
+        for (int x = qx0; x <= qx1; x++)
+        {
+            int cell = y * grid->columns + x;
+
+            for (int e = grid->cellStart[cell]; e < grid->cellStart[cell + 1]; e++)
+            {
+                const GridEntry* entry = &grid->entries[e];
+                if (!Overlaps(entry->bounds, rect)) continue;
+
+                int x0, y0, x1, y1;
+                CellRange(grid, entry->bounds, &x0, &y0, &x1, &y1);
+                if ((x != ((x0 > qx0)? x0 : qx0)) || (y != ((y0 > qy0)? y0 : qy0))) continue;
+
+                if (count >= maxOut) return count;
+                out[count++] = entry->id;
+            }
+        }
+    }
+
+    return count;
+}
+
+int QuerySegment(const Grid* grid, Vector2 start, Vector2 end, float radius, int* out, int maxOut)
+{
+    int count = 0;
+    float reach = radius + GRID_CELL_MARGIN * grid->cellSize;
+    Vector2 delta = Subtract(end, start);
+    int qy0 = CellCoord(grid, fminf(start.y, end.y) - reach, 1);
+    int qy1 = CellCoord(grid, fmaxf(start.y, end.y) + reach, 1);
+
+    // Walk the rows the thick segment crosses, visiting only the columns it spans inside each row
+    for (int y = qy0; y <= qy1; y++)
+    {
+        float bandMin = grid->origin.y + y * grid->cellSize - reach;
+        float bandMax = bandMin + grid->cellSize + 2.0f * reach;
+
+        // The outer rows also own everything beyond the grid
+        if (y == 0) bandMin = -INFINITY;
+        if (y == grid->rows - 1) bandMax = INFINITY;
+
+        float t0 = 0.0f;
+        float t1 = 1.0f;
+        if (fabsf(delta.y) < EPSILON)
+        {
+            if ((start.y < bandMin) || (start.y > bandMax)) continue;
+        }
+        else
+        {
+            float ta = (bandMin - start.y) / delta.y;
+            float tb = (bandMax - start.y) / delta.y;
+            if (ta > tb) { float t = ta; ta = tb; tb = t; }
+            t0 = fmaxf(t0, ta);
+            t1 = fminf(t1, tb);
+            if (t0 > t1) continue;
+        }
+
+        float xa = start.x + delta.x * t0;
+        float xb = start.x + delta.x * t1;
+        int qx0 = CellCoord(grid, fminf(xa, xb) - reach, 0);
+        int qx1 = CellCoord(grid, fmaxf(xa, xb) + reach, 0);
+
+        for (int x = qx0; x <= qx1; x++)
+        {
+            int cell = y * grid->columns + x;
+
+            for (int e = grid->cellStart[cell]; e < grid->cellStart[cell + 1]; e++)
+            {
+                const GridEntry* entry = &grid->entries[e];
+                if (!SegmentOverlaps(entry->bounds, start, end, radius)) continue;
+
+                // NOTE: The visited cells don't form a box, so hits are deduplicated against the (short) output instead
+                if (Reported(out, count, entry->id)) continue;
+
+                if (count >= maxOut) return count;
+                out[count++] = entry->id;
+            }
+        }
+    }
+
+    return count;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "Obstacles.h"
+
+// Uniform grid broadphase over static obstacles.
+// Cells are bucketed in one flat array (counting sort), each bucket stores a copy of its obstacle bounds
+// next to the obstacle id, so a query reads contiguous memory per cell instead of chasing indices.
+// Queries write obstacle ids into out (up to maxOut) and return how many were written, each id at most once.
+// NOTE: Queries don't modify the grid and are safe to run from several threads at once
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Grid cell entry type
+typedef struct GridEntry {
+    Aabb bounds;
+    int id;
+} GridEntry;
+
+// Uniform grid type
+typedef struct Grid {
+    Vector2 origin;         // World position of the top-left corner of cell (0, 0)
+    float cellSize;
+    float invCellSize;
+    int columns;
+    int rows;
+    int* cellStart;         // columns*rows + 1 offsets into entries, cell c owns [cellStart[c], cellStart[c + 1])
+    GridEntry* entries;
+    int entryCount;
+    int count;              // Number of obstacles indexed
+} Grid;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+// Build a grid over the obstacles, cellSize <= 0 picks one from the average obstacle size
+Grid LoadGrid(const Obstacles* obstacles, float cellSize);
+
+// Free grid data
+void UnloadGrid(Grid grid);
+
+// Find obstacles containing a point
+int QueryPoint(const Grid* grid, Vector2 point, int* out, int maxOut);
+
+// Find obstacles overlapping a circle
+int QueryCircle(const Grid* grid, Vector2 center, float radius, int* out, int maxOut);
+
+// Find obstacles overlapping a rectangle
+int QueryRect(const Grid* grid, Aabb rect, int* out, int maxOut);
+
+// Find obstacles touched by the segment from start to end, thickened by radius (0 for a thin segment)
+int QuerySegment(const Grid* grid, Vector2 start, Vector2 end, float radius, int* out, int maxOut);
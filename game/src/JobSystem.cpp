@@ -0,0 +1,405 @@
+#include "JobSystem.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <cstdint>
+#include <cstring>
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define JOB_SPIN_COUNT 64                       // Failed steal rounds before a worker goes to sleep
+#define JOB_CACHE_LINE 64
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Queued job type
+typedef struct Job {
+    JobFunction function;
+    void* context;
+    int begin;
+    int end;
+    JobCounter* counter;
+    const JobCounter* dependency;
+} Job;
+
+// Job parked on a counter it depends on
+typedef struct JobWaiter {
+    Job job;
+    struct JobWaiter* next;
+} JobWaiter;
+
+// Deque slot, a job stored by value as relaxed atomic words: a thief reads it before knowing whether it won the job,
+// while the owner may already be writing a new job there (the thief's claim then fails and the copy is dropped)
+#define JOB_SLOT_WORDS ((sizeof(Job) + sizeof(uint64_t) - 1)/sizeof(uint64_t))
+
+typedef struct JobSlot {
+    std::atomic<uint64_t> words[JOB_SLOT_WORDS];
+} JobSlot;
+
+// Per-thread work-stealing deque (Chase-Lev)
+typedef struct JobQueue {
+    alignas(JOB_CACHE_LINE) std::atomic<int64_t> top;
+    alignas(JOB_CACHE_LINE) std::atomic<int64_t> bottom;
+    JobSlot slots[JOB_QUEUE_SIZE];
+    uint32_t rngState;      // Victim selection
+} JobQueue;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static JobQueue* Queues = nullptr;          // Index 0 belongs to the thread that called InitJobSystem
+static std::thread* Workers = nullptr;
+static int WorkerCount = 0;
+static std::atomic<bool> Running{ false };
+static std::atomic<int> QueuedJobs{ 0 };    // Approximate, only used to decide when workers may sleep
+static std::atomic<int> PendingJobs{ 0 };   // Submitted and not finished yet, queued or parked
+static Job* SharedJobs = nullptr;           // Ring of jobs submitted by threads without a queue
+static int SharedHead = 0;
+static int SharedCount = 0;
+static std::atomic<int> SharedQueued{ 0 };  // SharedCount, readable without the lock
+static std::mutex SharedMutex;
+static std::mutex SleepMutex;
+static std::condition_variable SleepCondition;
+
+static thread_local int ThreadIndex = -1;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition - Deque
+//----------------------------------------------------------------------------------
+
+static void StoreJob(JobSlot* slot, const Job* job)
+{
+    uint64_t words[JOB_SLOT_WORDS] = { 0 };
+    memcpy(words, job, sizeof(Job));
+    for (size_t i = 0; i < JOB_SLOT_WORDS; i++) slot->words[i].store(words[i], std::memory_order_relaxed);
+}
+
+static Job LoadJob(const JobSlot* slot)
+{
+    uint64_t words[JOB_SLOT_WORDS];
+    for (size_t i = 0; i < JOB_SLOT_WORDS; i++) words[i] = slot->words[i].load(std::memory_order_relaxed);
+
+    Job job;
+    memcpy(&job, words, sizeof(Job));
+    return job;
+}
+
+// Owner only: push a job at the bottom, returns false when the queue is full
+static bool PushJob(JobQueue* queue, const Job* job)
+{
+    int64_t b = queue->bottom.load(std::memory_order_relaxed);
+    int64_t t = queue->top.load(std::memory_order_acquire);
+    if (b - t >= JOB_QUEUE_SIZE) return false;
+
+    StoreJob(&queue->slots[b & (JOB_QUEUE_SIZE - 1)], job);
+    std::atomic_thread_fence(std::memory_order_release);
+    queue->bottom.store(b + 1, std::memory_order_relaxed);
+
+    return true;
+}
+
+// Owner only: pop the most recently pushed job into out, returns false when there is none
+static bool PopJob(JobQueue* queue, Job* out)
+{
+    int64_t b = queue->bottom.load(std::memory_order_relaxed) - 1;
+    queue->bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = queue->top.load(std::memory_order_relaxed);
+
+    if (t > b)
+    {
+        // Empty
+        queue->bottom.store(b + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    *out = LoadJob(&queue->slots[b & (JOB_QUEUE_SIZE - 1)]);
+    bool found = true;
+
+    if (t == b)
+    {
+        // Last job, race the thieves for it
+        found = queue->top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        queue->bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    return found;
+}
+
+// Any thread: take the oldest job into out, returns false when there is none or another thread won it
+static bool StealJob(JobQueue* queue, Job* out)
+{
+    int64_t t = queue->top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = queue->bottom.load(std::memory_order_acquire);
+    if (t >= b) return false;
+
+    // NOTE: Copy before claiming it, once top moves on the owner may push a new job into the slot
+    Job job = LoadJob(&queue->slots[t & (JOB_QUEUE_SIZE - 1)]);
+    if (!queue->top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) return false;
+
+    *out = job;
+    return true;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition - Shared queue
+//----------------------------------------------------------------------------------
+
+static bool PushSharedJob(const Job* job)
+{
+    std::lock_guard<std::mutex> lock(SharedMutex);
+    if (SharedCount == JOB_SHARED_QUEUE_SIZE) return false;
+
+    SharedJobs[(SharedHead + SharedCount)%JOB_SHARED_QUEUE_SIZE] = *job;
+    SharedCount++;
+    SharedQueued.store(SharedCount, std::memory_order_release);
+
+    return true;
+}
+
+static bool PopSharedJob(Job* out)
+{
+    if (SharedQueued.load(std::memory_order_acquire) == 0) return false;
+
+    std::lock_guard<std::mutex> lock(SharedMutex);
+    if (SharedCount == 0) return false;
+
+    *out = SharedJobs[SharedHead];
+    SharedHead = (SharedHead + 1)%JOB_SHARED_QUEUE_SIZE;
+    SharedCount--;
+    SharedQueued.store(SharedCount, std::memory_order_release);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition - Scheduling
+//----------------------------------------------------------------------------------
+
+static void LockCounter(const JobCounter* counter)
+{
+    while (counter->locked.exchange(true, std::memory_order_acquire)) std::this_thread::yield();
+}
+
+static void UnlockCounter(const JobCounter* counter)
+{
+    counter->locked.store(false, std::memory_order_release);
+}
+
+static void Execute(const Job& job);
+
+// Queue a job whose dependency is met, or run it right away when that isn't possible
+static void Enqueue(const Job& job)
+{
+    bool queued = false;
+    if (Running.load(std::memory_order_relaxed)) queued = (ThreadIndex < 0)? PushSharedJob(&job) : PushJob(&Queues[ThreadIndex], &job);
+
+    if (!queued)
+    {
+        Execute(job);
+        return;
+    }
+
+    QueuedJobs.fetch_add(1, std::memory_order_release);
+    SleepCondition.notify_one();
+}
+
+// Park a job on its dependency while that isn't zero, returns false when it is (the job can be queued)
+static bool ParkJob(const Job& job)
+{
+    const JobCounter* dependency = job.dependency;
+    if ((dependency == nullptr) || (dependency->value.load(std::memory_order_acquire) == 0)) return false;
+
+    LockCounter(dependency);
+
+    // NOTE: The final decrement happens under the lock, so a job parked here is always released by it
+    bool parked = (dependency->value.load(std::memory_order_acquire) > 0);
+    if (parked) dependency->waiters = new JobWaiter{ job, dependency->waiters };
+
+    UnlockCounter(dependency);
+
+    return parked;
+}
+
+// Count one job of counter as finished, queueing the jobs parked on it when it reaches zero
+static void FinishJob(JobCounter* counter)
+{
+    // Not the last job: a plain decrement, the counter isn't touched afterwards
+    int value = counter->value.load(std::memory_order_relaxed);
+    while (value > 1)
+    {
+        if (counter->value.compare_exchange_weak(value, value - 1, std::memory_order_acq_rel, std::memory_order_relaxed)) return;
+    }
+
+    // Last job: reach zero under the lock, WaitForCounter doesn't return (and the counter can't go away) before it is released
+    LockCounter(counter);
+    JobWaiter* waiters = nullptr;
+    if (counter->value.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        waiters = counter->waiters;
+        counter->waiters = nullptr;
+    }
+    UnlockCounter(counter);
+
+    while (waiters != nullptr)
+    {
+        JobWaiter* next = waiters->next;
+        Enqueue(waiters->job);
+        delete waiters;
+        waiters = next;
+    }
+}
+
+// Run a job on the calling thread, its dependency is met
+static void Execute(const Job& job)
+{
+    job.function(job.context, job.begin, job.end);
+    if (job.counter != nullptr) FinishJob(job.counter);
+
+    PendingJobs.fetch_sub(1, std::memory_order_release);
+}
+
+// Queue a job on the calling thread, park it on its dependency, or run it right away
+static void Submit(const Job& job)
+{
+    if (job.counter != nullptr) job.counter->value.fetch_add(1, std::memory_order_relaxed);
+    PendingJobs.fetch_add(1, std::memory_order_relaxed);
+
+    if (!ParkJob(job)) Enqueue(job);
+}
+
+// Find a job (own queue first, then steal, then the shared queue) and run it, returns false if there was nothing to do
+static bool RunPendingJob(void)
+{
+    JobQueue* own = &Queues[ThreadIndex];
+    Job job;
+    bool found = PopJob(own, &job);
+
+    for (int attempt = 0; !found && (attempt <= WorkerCount); attempt++)
+    {
+        own->rngState = own->rngState * 1664525u + 1013904223u;
+        int victim = (int)((own->rngState >> 16) % (uint32_t)(WorkerCount + 1));
+        if (victim != ThreadIndex) found = StealJob(&Queues[victim], &job);
+    }
+
+    if (!found) found = PopSharedJob(&job);
+
+    if (!found) return false;
+
+    QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+    Execute(job);
+
+    return true;
+}
+
+static void WorkerMain(int index)
+{
+    ThreadIndex = index;
+    int idle = 0;
+
+    while (Running.load(std::memory_order_acquire))
+    {
+        if (RunPendingJob())
+        {
+            idle = 0;
+            continue;
+        }
+
+        if (++idle < JOB_SPIN_COUNT)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Nothing to steal for a while, sleep until a job is queued (timeout guards against missed wakeups)
+        std::unique_lock<std::mutex> lock(SleepMutex);
+        SleepCondition.wait_for(lock, std::chrono::milliseconds(1), []() { return (QueuedJobs.load(std::memory_order_acquire) > 0) || !Running.load(); });
+        idle = 0;
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+void InitJobSystem(int workerCount)
+{
+    if (Running.load()) return;
+
+    if (workerCount <= 0) workerCount = (int)std::thread::hardware_concurrency() - 1;
+    if (workerCount < 1) workerCount = 1;
+
+    WorkerCount = workerCount;
+    Queues = new JobQueue[workerCount + 1]();
+    SharedJobs = new Job[JOB_SHARED_QUEUE_SIZE];
+    SharedHead = 0;
+    SharedCount = 0;
+
+    for (int i = 0; i <= workerCount; i++) Queues[i].rngState = 0x9E3779B9u * (uint32_t)(i + 1);
+
+    ThreadIndex = 0;
+    Running.store(true);
+
+    Workers = new std::thread[workerCount];
+    for (int i = 0; i < workerCount; i++) Workers[i] = std::thread(WorkerMain, i + 1);
+}
+
+void ShutdownJobSystem(void)
+{
+    if (!Running.load()) return;
+
+    // Stop first: from here on jobs submitted from inside jobs (or other threads) run inline instead of being queued
+    Running.store(false);
+    SleepCondition.notify_all();
+    for (int i = 0; i < WorkerCount; i++) Workers[i].join();
+
+    // Run what the workers left queued, and the jobs that get released from their counters on the way
+    while (PendingJobs.load(std::memory_order_acquire) > 0)
+    {
+        if (!RunPendingJob()) std::this_thread::yield();
+    }
+
+    delete[] Workers;
+    delete[] Queues;
+    delete[] SharedJobs;
+    Workers = nullptr;
+    Queues = nullptr;
+    SharedJobs = nullptr;
+    WorkerCount = 0;
+    ThreadIndex = -1;
+}
+
+int GetWorkerCount(void)
+{
+    return WorkerCount;
+}
+
+void RunJob(JobFunction function, void* context, JobCounter* counter, const JobCounter* dependency)
+{
+    Job job = { function, context, 0, 1, counter, dependency };
+    Submit(job);
+}
+
+void ParallelFor(int count, int batchSize, JobFunction function, void* context, JobCounter* counter, const JobCounter* dependency)
+{
+    if (batchSize < 1) batchSize = 1;
+
+    for (int begin = 0; begin < count; begin += batchSize)
+    {
+        Job job = { function, context, begin, (begin + batchSize < count)? begin + batchSize : count, counter, dependency };
+        Submit(job);
+    }
+}
+
+void WaitForCounter(const JobCounter* counter)
+{
+    // NOTE: The lock is held through the final decrement and the hand-over of the parked jobs
+    while ((counter->value.load(std::memory_order_acquire) > 0) || counter->locked.load(std::memory_order_acquire))
+    {
+        if ((ThreadIndex < 0) || !Running.load(std::memory_order_relaxed) || !RunPendingJob()) std::this_thread::yield();
+    }
+}
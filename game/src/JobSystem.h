@@ -0,0 +1,57 @@
+#pragma once
+#include <atomic>
+
+// Work-stealing job system.
+// One worker thread per core (minus the main thread), each with its own lock-free deque: the owner pushes
+// and pops at the bottom, idle workers steal from the top of a random victim. The main thread only submits
+// and waits, it never runs jobs unless it is blocked in WaitForCounter.
+// Completion is tracked with counters: submitting a job increments its counter, finishing it decrements.
+// A job may also depend on a counter: until that counter reaches zero the job is parked on it (no thread
+// blocks on it), the job that brings the counter to zero queues the parked jobs.
+// Other threads (e.g. asset I/O threads) submit to a shared locked queue the workers take jobs from, they
+// don't run jobs themselves, WaitForCounter only yields on them.
+// NOTE: A dependency counter must outlive the jobs that depend on it, wait on their own counters before releasing it
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define JOB_QUEUE_SIZE 4096         // Jobs in flight per thread (power of two), a full queue runs jobs inline
+#define JOB_SHARED_QUEUE_SIZE 1024  // Jobs in flight from other threads, a full queue runs jobs inline
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Job entry point, processes items [begin, end) of the job's range
+typedef void (*JobFunction)(void* context, int begin, int end);
+
+struct JobWaiter;
+
+// Job completion counter type, zero when every job attached to it has finished
+typedef struct JobCounter {
+    std::atomic<int> value{ 0 };
+    mutable std::atomic<bool> locked{ false };      // Guards waiters and the final decrement
+    mutable struct JobWaiter* waiters = nullptr;    // Jobs parked until value reaches zero
+} JobCounter;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+// Start the worker threads, workerCount <= 0 starts one per core minus the calling thread
+void InitJobSystem(int workerCount);
+
+// Stop the workers, then run every job still queued or parked on the calling thread
+void ShutdownJobSystem(void);
+
+// Get the number of worker threads (0 when the job system is not running)
+int GetWorkerCount(void);
+
+// Queue a job running function(context, 0, 1) once dependency (optional) is zero
+void RunJob(JobFunction function, void* context, JobCounter* counter, const JobCounter* dependency = nullptr);
+
+// Queue function over [0, count) split into batches of batchSize items, once dependency (optional) is zero
+void ParallelFor(int count, int batchSize, JobFunction function, void* context, JobCounter* counter, const JobCounter* dependency = nullptr);
+
+// Block until counter reaches zero, running queued jobs meanwhile
+void WaitForCounter(const JobCounter* counter);
@@ -0,0 +1,208 @@
+#include "Lz4.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define LZ4_HASH_BITS 16
+#define LZ4_MIN_MATCH 4
+#define LZ4_LAST_LITERALS 5         // The block always ends with at least this many literals
+#define LZ4_MATCH_FIND_LIMIT 12     // No match may start within this many bytes of the end
+#define LZ4_MAX_OFFSET 65535
+#define LZ4_SKIP_TRIGGER 6          // Search step grows by one every 2^LZ4_SKIP_TRIGGER failed probes
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+static inline uint32_t Read32(const unsigned char* p)
+{
+    uint32_t value;
+    memcpy(&value, p, 4);
+    return value;
+}
+
+static inline uint32_t Hash32(uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - LZ4_HASH_BITS);
+}
+
+// Write a length continuation (the part above 15) as a run of 255s and a remainder
+static unsigned char* WriteLength(unsigned char* op, const unsigned char* end, int length)
+{
+    for (; length >= 255; length -= 255)
+    {
+        if (op >= end) return nullptr;
+        *op++ = 255;
+    }
+
+    if (op >= end) return nullptr;
+    *op++ = (unsigned char)length;
+
+    return op;
+}
+
+// Write one sequence: literals, then (when matchLength > 0) the match
+static unsigned char* WriteSequence(unsigned char* op, const unsigned char* end, const unsigned char* literals, int literalLength, int offset, int matchLength)
+{
+    if (op >= end) return nullptr;
+
+    unsigned char* token = op++;
+    int matchCode = (matchLength > 0)? matchLength - LZ4_MIN_MATCH : 0;
+    *token = (unsigned char)(((literalLength < 15)? literalLength : 15) << 4);
+    if (matchLength > 0) *token |= (unsigned char)((matchCode < 15)? matchCode : 15);
+
+    if ((literalLength >= 15) && ((op = WriteLength(op, end, literalLength - 15)) == nullptr)) return nullptr;
+
+    if (end - op < literalLength) return nullptr;
+    if (literalLength > 0) memcpy(op, literals, literalLength);
+    op += literalLength;
+
+    if (matchLength == 0) return op;
+
+    if (end - op < 2) return nullptr;
+    *op++ = (unsigned char)(offset & 0xFF);
+    *op++ = (unsigned char)(offset >> 8);
+
+    if (matchCode >= 15) op = WriteLength(op, end, matchCode - 15);
+
+    return op;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+int GetLz4Bound(int size)
+{
+    return size + size/255 + 16;
+}
+
+int CompressLz4(const void* src, int srcSize, void* dst, int dstCapacity)
+{
+    const unsigned char* input = (const unsigned char*)src;
+    unsigned char* op = (unsigned char*)dst;
+    const unsigned char* end = op + dstCapacity;
+    int anchor = 0;
+
+    if (srcSize > LZ4_MATCH_FIND_LIMIT)
+    {
+        // Positions + 1 so zero means empty
+        uint32_t* table = (uint32_t*)calloc(1 << LZ4_HASH_BITS, sizeof(uint32_t));
+        int findLimit = srcSize - LZ4_MATCH_FIND_LIMIT;
+        int matchLimit = srcSize - LZ4_LAST_LITERALS;
+        int ip = 0;
+        int probes = 1 << LZ4_SKIP_TRIGGER;
+
+        while (ip < findLimit)
+        {
+            uint32_t sequence = Read32(input + ip);
+            uint32_t hash = Hash32(sequence);
+            int ref = (int)table[hash] - 1;
+            table[hash] = (uint32_t)ip + 1;
+
+            if ((ref < 0) || (ip - ref > LZ4_MAX_OFFSET) || (Read32(input + ref) != sequence))
+            {
+                ip += probes++ >> LZ4_SKIP_TRIGGER;
+                continue;
+            }
+
+            // Extend the match backwards over pending literals, then forwards
+            while ((ip > anchor) && (ref > 0) && (input[ip - 1] == input[ref - 1]))
+            {
+                ip--;
+                ref--;
+            }
+
+            int length = LZ4_MIN_MATCH;
+            while ((ip + length < matchLimit) && (input[ip + length] == input[ref + length])) length++;
+
+            op = WriteSequence(op, end, input + anchor, ip - anchor, ip - ref, length);
+            if (op == nullptr)
+            {
+                free(table);
+                return 0;
+            }
+
+            ip += length;
+            anchor = ip;
+            probes = 1 << LZ4_SKIP_TRIGGER;
+
+            // Index a position inside the match so the next search has a recent candidate
+            if (ip - 2 < findLimit) table[Hash32(Read32(input + ip - 2))] = (uint32_t)(ip - 2) + 1;
+        }
+
+        free(table);
+    }
+
+    op = WriteSequence(op, end, input + anchor, srcSize - anchor, 0, 0);
+
+    return (op == nullptr)? 0 : (int)(op - (unsigned char*)dst);
+}
+
+int DecompressLz4(const void* src, int srcSize, void* dst, int dstCapacity)
+{
+    const unsigned char* ip = (const unsigned char*)src;
+    const unsigned char* inputEnd = ip + srcSize;
+    unsigned char* output = (unsigned char*)dst;
+    int op = 0;
+
+    while (ip < inputEnd)
+    {
+        int token = *ip++;
+
+        // Literals
+        int literalLength = token >> 4;
+        if (literalLength == 15)
+        {
+            int extra;
+            do
+            {
+                if (ip >= inputEnd) return -1;
+                extra = *ip++;
+                literalLength += extra;
+            } while (extra == 255);
+        }
+
+        if ((inputEnd - ip < literalLength) || (dstCapacity - op < literalLength)) return -1;
+        memcpy(output + op, ip, literalLength);
+        ip += literalLength;
+        op += literalLength;
+
+        // The last sequence has no match
+        if (ip == inputEnd) break;
+
+        // Match
+        if (inputEnd - ip < 2) return -1;
+        int offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if ((offset == 0) || (offset > op)) return -1;
+
+        int matchLength = token & 15;
+        if (matchLength == 15)
+        {
+            int extra;
+            do
+            {
+                if (ip >= inputEnd) return -1;
+                extra = *ip++;
+                matchLength += extra;
+            } while (extra == 255);
+        }
+        matchLength += LZ4_MIN_MATCH;
+
+        if (dstCapacity - op < matchLength) return -1;
+
+        // Overlapping matches repeat the last offset bytes, copy them one at a time
+        unsigned char* copy = output + op;
+        const unsigned char* from = copy - offset;
+        if (offset >= matchLength) memcpy(copy, from, matchLength);
+        else for (int i = 0; i < matchLength; i++) copy[i] = from[i];
+
+        op += matchLength;
+    }
+
+    return op;
+}
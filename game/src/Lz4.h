@@ -0,0 +1,20 @@
+#pragma once
+
+// LZ4 block format codec (no frame format, no dictionary).
+// Output is compatible with the reference LZ4 block decoder and vice versa. The compressor is the
+// simple greedy single-hash variant: fast and allocation free apart from its hash table, with ratios a
+// bit below the reference fast mode. The decompressor checks every read and write against the buffers,
+// so malformed input fails instead of overrunning.
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+// Get the worst case compressed size of size bytes
+int GetLz4Bound(int size);
+
+// Compress a block, returns the compressed size or 0 if it doesn't fit in dstCapacity
+int CompressLz4(const void* src, int srcSize, void* dst, int dstCapacity);
+
+// Decompress a block, returns the decompressed size or -1 if the data is malformed or larger than dstCapacity
+int DecompressLz4(const void* src, int srcSize, void* dst, int dstCapacity);
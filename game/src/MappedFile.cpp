@@ -0,0 +1,162 @@
+#include "MappedFile.h"
+#include <cerrno>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define CHECKSUM_PRIME1 0x9E3779B185EBCA87ull
+#define CHECKSUM_PRIME2 0xC2B2AE3D27D4EB4Full
+#define CHECKSUM_PRIME3 0x165667B19E3779F9ull
+
+#define PARSE_MAX_FLOAT_CHARS 64        // Longest number the strtof fallback reads
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+static inline uint64_t RotateLeft(uint64_t x, int bits)
+{
+    return (x << bits) | (x >> (64 - bits));
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+MappedFile LoadMappedFile(const char* fileName)
+{
+    MappedFile file = { 0 };
+
+#if defined(_WIN32)
+    HANDLE handle = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) return file;
+
+    LARGE_INTEGER size = { 0 };
+    if (!GetFileSizeEx(handle, &size) || (size.QuadPart == 0))
+    {
+        CloseHandle(handle);
+        return file;
+    }
+
+    HANDLE mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* view = (mapping != nullptr)? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (view == nullptr)
+    {
+        if (mapping != nullptr) CloseHandle(mapping);
+        CloseHandle(handle);
+        return file;
+    }
+
+    file.data = (const unsigned char*)view;
+    file.size = (size_t)size.QuadPart;
+    file.fileHandle = handle;
+    file.mappingHandle = mapping;
+#else
+    int descriptor = open(fileName, O_RDONLY);
+    if (descriptor < 0) return file;
+
+    struct stat info = { 0 };
+    if ((fstat(descriptor, &info) != 0) || (info.st_size == 0))
+    {
+        close(descriptor);
+        return file;
+    }
+
+    void* view = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);      // The mapping keeps its own reference
+    if (view == MAP_FAILED) return file;
+
+    file.data = (const unsigned char*)view;
+    file.size = (size_t)info.st_size;
+#endif
+
+    return file;
+}
+
+void UnloadMappedFile(MappedFile file)
+{
+    if (file.data == nullptr) return;
+
+#if defined(_WIN32)
+    UnmapViewOfFile(file.data);
+    CloseHandle((HANDLE)file.mappingHandle);
+    CloseHandle((HANDLE)file.fileHandle);
+#else
+    munmap((void*)file.data, file.size);
+#endif
+}
+
+bool ParseFloat(const char** p, const char* end, float* value)
+{
+    const char* s = *p;
+    while ((s < end) && ((*s == ' ') || (*s == '\t') || (*s == '\r'))) s++;
+    if ((s < end) && (*s == '+')) s++;
+
+#if defined(__cpp_lib_to_chars)
+    std::from_chars_result result = std::from_chars(s, end, *value);
+    *p = result.ptr;
+
+    return (result.ec == std::errc());
+#else
+    // NOTE: Standard libraries without floating point from_chars (libc++ before LLVM 20, older Xcode) use strtof,
+    // on a NUL-terminated copy since the mapped text isn't terminated. Unlike from_chars it follows the C locale
+    char buffer[PARSE_MAX_FLOAT_CHARS + 1];
+    size_t length = ((size_t)(end - s) < PARSE_MAX_FLOAT_CHARS)? (size_t)(end - s) : PARSE_MAX_FLOAT_CHARS;
+    memcpy(buffer, s, length);
+    buffer[length] = '\0';
+
+    char* last = buffer;
+    errno = 0;
+    float parsed = strtof(buffer, &last);
+    *p = s + (last - buffer);
+    if ((last == buffer) || (errno == ERANGE)) return false;
+
+    *value = parsed;
+    return true;
+#endif
+}
+
+uint64_t Checksum64(const void* data, size_t size, uint64_t seed)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    uint64_t hash = seed ^ (size * CHECKSUM_PRIME1);
+
+    // 8 bytes per round
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        uint64_t word;
+        memcpy(&word, bytes + i, 8);
+        hash ^= RotateLeft(word * CHECKSUM_PRIME2, 31) * CHECKSUM_PRIME1;
+        hash = RotateLeft(hash, 27) * CHECKSUM_PRIME1 + CHECKSUM_PRIME3;
+    }
+
+    for (; i < size; i++)
+    {
+        hash ^= bytes[i] * CHECKSUM_PRIME3;
+        hash = RotateLeft(hash, 11) * CHECKSUM_PRIME1;
+    }
+
+    // Final avalanche so every input bit affects every output bit
+    hash ^= hash >> 33;
+    hash *= CHECKSUM_PRIME2;
+    hash ^= hash >> 29;
+    hash *= CHECKSUM_PRIME3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
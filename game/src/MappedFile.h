@@ -0,0 +1,37 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Read-only memory-mapped files and content checksums for binary caches.
+// A mapped file is paged in by the OS on first touch, loaders can point straight into it instead of
+// reading and copying, and the same pages are shared between runs through the file cache.
+// Mapped text isn't NUL-terminated, ParseFloat reads numbers from it by range.
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Mapped file type
+typedef struct MappedFile {
+    const unsigned char* data;      // NULL when the file could not be mapped
+    size_t size;
+    void* fileHandle;               // Windows only
+    void* mappingHandle;            // Windows only
+} MappedFile;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+// Map a whole file read-only (data is NULL if it doesn't exist or is empty)
+MappedFile LoadMappedFile(const char* fileName);
+
+// Unmap a file, pointers into it become invalid
+void UnloadMappedFile(MappedFile file);
+
+// Parse a float after optional blanks (spaces, tabs, '\r') and '+', advancing *p past it, false (value untouched)
+// when there is none or it is out of range
+bool ParseFloat(const char** p, const char* end, float* value);
+
+// Compute a 64-bit checksum of a memory block, for detecting changed source files (not cryptographic)
+uint64_t Checksum64(const void* data, size_t size, uint64_t seed = 0);
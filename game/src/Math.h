@@ -1,6 +1,9 @@
 #pragma once
-#include <corecrt_math.h>
+#include <math.h>
 #include <cstdlib>
+#include <cstdint>
+#include <atomic>
+#include <type_traits>
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -23,6 +26,22 @@
 #define RAD2DEG (180.0f/PI)
 #endif
 
+// SIMD instruction sets available to the batch kernels
+// NOTE: Define MATH_NO_SIMD to force the scalar fallback
+#if !defined(MATH_NO_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define MATH_SSE2
+#include <emmintrin.h>
+#if defined(__AVX2__)
+#define MATH_AVX2
+#include <immintrin.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define MATH_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
 // Get float vector for Matrix
 #ifndef MatrixToFloat
 #define MatrixToFloat(mat) (ToFloatV(mat).v)
@@ -83,6 +102,18 @@ typedef struct Matrix {
 #define RL_MATRIX_TYPE
 #endif
 
+// Axis-aligned bounding box type
+typedef struct Aabb {
+    Vector2 min;
+    Vector2 max;
+} Aabb;
+
+// Random number generator state (xoshiro128**)
+// NOTE: Not thread-safe, give each thread or system its own generator
+typedef struct Rng {
+    uint32_t s[4];
+} Rng;
+
 // NOTE: Helper types to be used instead of array return types for *ToFloat functions
 typedef struct float3 {
     float v[3]{};
@@ -96,14 +127,76 @@ typedef struct float16 {
 // Module Functions Definition - Utils math
 //----------------------------------------------------------------------------------
 
+// Create a generator from a 64-bit seed (equal seeds produce equal sequences)
+RMAPI Rng SeedRng(uint64_t seed)
+{
+    Rng result = { 0 };
+
+    // Expand the seed with splitmix64 so similar seeds give unrelated states
+    for (int i = 0; i < 4; i += 2)
+    {
+        uint64_t z = (seed += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        z = z ^ (z >> 31);
+        result.s[i] = (uint32_t)z;
+        result.s[i + 1] = (uint32_t)(z >> 32);
+    }
+
+    return result;
+}
+
+// Next 32 random bits of the generator
+RMAPI uint32_t RandomBits(Rng* rng)
+{
+    uint32_t* s = rng->s;
+    uint32_t x = s[1] * 5;
+    uint32_t result = ((x << 7) | (x >> 25)) * 9;
+    uint32_t t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 11) | (s[3] >> 21);
+
+    return result;
+}
+
+// Random value between min and max (can be negative) from the given generator
+RMAPI float Random(Rng* rng, float min, float max)
+{
+    // Top 24 bits map exactly onto the float mantissa, giving a value in [0, 1)
+    float unit = (float)(RandomBits(rng) >> 8) * (1.0f / 16777216.0f);
+
+    return min + unit * (max - min);
+}
+
+// Get the calling thread's generator used by Random(min, max)
+// NOTE: Threads are seeded in order of first use, call SeedRandom() for reproducible sequences
+RMAPI Rng* ThreadRng(void)
+{
+    static std::atomic<uint64_t> nextSeed(0);
+    thread_local Rng rng = SeedRng(nextSeed.fetch_add(1));
+
+    return &rng;
+}
+
+// Reseed the calling thread's generator
+RMAPI void SeedRandom(uint64_t seed)
+{
+    *ThreadRng() = SeedRng(seed);
+}
+
 // Random value between min and max (can be negative)
 RMAPI float Random(float min, float max)
 {
-    return min + (rand() / ((float)RAND_MAX / (max - min)));
+    return Random(ThreadRng(), min, max);
 }
 
 // Clamp float value
-RMAPI float Clamp(float value, float min, float max)
+RMAPI constexpr float Clamp(float value, float min, float max)
 {
     float result = (value < min) ? min : value;
 
@@ -113,7 +206,7 @@ RMAPI float Clamp(float value, float min, float max)
 }
 
 // Calculate linear interpolation between two floats
-RMAPI float Lerp(float start, float end, float amount)
+RMAPI constexpr float Lerp(float start, float end, float amount)
 {
     float result = start + amount * (end - start);
 
@@ -121,7 +214,7 @@ RMAPI float Lerp(float start, float end, float amount)
 }
 
 // Normalize input value within input range
-RMAPI float Normalize(float value, float start, float end)
+RMAPI constexpr float Normalize(float value, float start, float end)
 {
     float result = (value - start) / (end - start);
 
@@ -129,7 +222,7 @@ RMAPI float Normalize(float value, float start, float end)
 }
 
 // Remap input value within input range to output range
-RMAPI float Remap(float value, float inputStart, float inputEnd, float outputStart, float outputEnd)
+RMAPI constexpr float Remap(float value, float inputStart, float inputEnd, float outputStart, float outputEnd)
 {
     float result = (value - inputStart) / (inputEnd - inputStart) * (outputEnd - outputStart) + outputStart;
 
@@ -153,7 +246,7 @@ RMAPI int Equals(float x, float y)
 }
 
 // Vector with components value 0.0f
-RMAPI Vector2 Vector2Zero(void)
+RMAPI constexpr Vector2 Vector2Zero(void)
 {
     Vector2 result = { 0.0f, 0.0f };
 
@@ -161,21 +254,21 @@ RMAPI Vector2 Vector2Zero(void)
 }
 
 // Vector with components value 1.0f
-RMAPI Vector2 Vector2One(void)
+RMAPI constexpr Vector2 Vector2One(void)
 {
     Vector2 result = { 1.0f, 1.0f };
 
     return result;
 }
 
-RMAPI Vector3 ToV3(Vector2 v)
+RMAPI constexpr Vector3 ToV3(Vector2 v)
 {
     Vector3 result = { v.x, v.y, 0.0f };
 
     return result;
 }
 
-RMAPI Vector2 FromV3(Vector3 v)
+RMAPI constexpr Vector2 FromV3(Vector3 v)
 {
     Vector2 result = { v.x, v.y };
 
@@ -183,7 +276,7 @@ RMAPI Vector2 FromV3(Vector3 v)
 }
 
 // Add two vectors (v1 + v2)
-RMAPI Vector2 Add(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Add(Vector2 v1, Vector2 v2)
 {
     Vector2 result = { v1.x + v2.x, v1.y + v2.y };
 
@@ -191,7 +284,7 @@ RMAPI Vector2 Add(Vector2 v1, Vector2 v2)
 }
 
 // Add vector and float value
-RMAPI Vector2 Add(Vector2 v, float add)
+RMAPI constexpr Vector2 Add(Vector2 v, float add)
 {
     Vector2 result = { v.x + add, v.y + add };
 
@@ -199,7 +292,7 @@ RMAPI Vector2 Add(Vector2 v, float add)
 }
 
 // Subtract two vectors (v1 - v2)
-RMAPI Vector2 Subtract(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Subtract(Vector2 v1, Vector2 v2)
 {
     Vector2 result = { v1.x - v2.x, v1.y - v2.y };
 
@@ -207,7 +300,7 @@ RMAPI Vector2 Subtract(Vector2 v1, Vector2 v2)
 }
 
 // Subtract vector by float value
-RMAPI Vector2 Subtract(Vector2 v, float sub)
+RMAPI constexpr Vector2 Subtract(Vector2 v, float sub)
 {
     Vector2 result = { v.x - sub, v.y - sub };
 
@@ -222,7 +315,7 @@ RMAPI float Length(Vector2 v)
 }
 
 // Calculate vector square length
-RMAPI float LengthSqr(Vector2 v)
+RMAPI constexpr float LengthSqr(Vector2 v)
 {
     float result = (v.x * v.x) + (v.y * v.y);
 
@@ -230,14 +323,14 @@ RMAPI float LengthSqr(Vector2 v)
 }
 
 // Calculate two vectors dot product
-RMAPI float Dot(Vector2 v1, Vector2 v2)
+RMAPI constexpr float Dot(Vector2 v1, Vector2 v2)
 {
     float result = (v1.x * v2.x + v1.y * v2.y);
 
     return result;
 }
 
-RMAPI float Cross(Vector2 v1, Vector2 v2)
+RMAPI constexpr float Cross(Vector2 v1, Vector2 v2)
 {
     float result = v1.x * v2.y - v1.y * v2.x;
 
@@ -253,7 +346,7 @@ RMAPI float Distance(Vector2 v1, Vector2 v2)
 }
 
 // Calculate square distance between two vectors
-RMAPI float DistanceSqr(Vector2 v1, Vector2 v2)
+RMAPI constexpr float DistanceSqr(Vector2 v1, Vector2 v2)
 {
     float result = ((v1.x - v2.x) * (v1.x - v2.x) + (v1.y - v2.y) * (v1.y - v2.y));
 
@@ -261,7 +354,7 @@ RMAPI float DistanceSqr(Vector2 v1, Vector2 v2)
 }
 
 // -1 if below zero, +1 if above zero
-RMAPI float Sign(float value)
+RMAPI constexpr float Sign(float value)
 {
     float result = (value < 0.0f) ? -1.0f : 1.0f;
 
@@ -308,7 +401,7 @@ RMAPI float SignedAngle(Vector2 from, Vector2 to)
 }
 
 // Scale vector (multiply by value)
-RMAPI Vector2 Scale(Vector2 v, float scale)
+RMAPI constexpr Vector2 Scale(Vector2 v, float scale)
 {
     Vector2 result = { v.x * scale, v.y * scale };
 
@@ -316,14 +409,14 @@ RMAPI Vector2 Scale(Vector2 v, float scale)
 }
 
 // Project v1 onto v2
-RMAPI Vector2 Project(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Project(Vector2 v1, Vector2 v2)
 {
     float t = Dot(v1, v2) / Dot(v2, v2);
     return { t * v2.x, t * v2.y };
 }
 
 // Projects point P onto line AB
-RMAPI Vector2 ProjectPointLine(Vector2 A, Vector2 B, Vector2 P)
+RMAPI constexpr Vector2 ProjectPointLine(Vector2 A, Vector2 B, Vector2 P)
 {
     Vector2 AB = Subtract(B, A);
     float t = Dot(Subtract(P, A), AB) / Dot(AB, AB);
@@ -331,7 +424,7 @@ RMAPI Vector2 ProjectPointLine(Vector2 A, Vector2 B, Vector2 P)
 }
 
 // Multiply vector by vector
-RMAPI Vector2 Multiply(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Multiply(Vector2 v1, Vector2 v2)
 {
     Vector2 result = { v1.x * v2.x, v1.y * v2.y };
 
@@ -339,7 +432,7 @@ RMAPI Vector2 Multiply(Vector2 v1, Vector2 v2)
 }
 
 // Negate vector
-RMAPI Vector2 Negate(Vector2 v)
+RMAPI constexpr Vector2 Negate(Vector2 v)
 {
     Vector2 result = { -v.x, -v.y };
 
@@ -347,7 +440,7 @@ RMAPI Vector2 Negate(Vector2 v)
 }
 
 // Divide vector by vector
-RMAPI Vector2 Divide(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Divide(Vector2 v1, Vector2 v2)
 {
     Vector2 result = { v1.x / v2.x, v1.y / v2.y };
 
@@ -371,7 +464,7 @@ RMAPI Vector2 Normalize(Vector2 v)
 }
 
 // Transforms a Vector2 by a given Matrix
-RMAPI Vector2 Multiply(Vector2 v, Matrix mat)
+RMAPI constexpr Vector2 Multiply(Vector2 v, Matrix mat)
 {
     Vector2 result = { 0 };
 
@@ -386,7 +479,7 @@ RMAPI Vector2 Multiply(Vector2 v, Matrix mat)
 }
 
 // Calculate linear interpolation between two vectors
-RMAPI Vector2 Lerp(Vector2 v1, Vector2 v2, float amount)
+RMAPI constexpr Vector2 Lerp(Vector2 v1, Vector2 v2, float amount)
 {
     Vector2 result = { 0 };
 
@@ -397,7 +490,7 @@ RMAPI Vector2 Lerp(Vector2 v1, Vector2 v2, float amount)
 }
 
 // Calculate reflected vector to normal
-RMAPI Vector2 Reflect(Vector2 v, Vector2 normal)
+RMAPI constexpr Vector2 Reflect(Vector2 v, Vector2 normal)
 {
     Vector2 result = { 0 };
 
@@ -450,7 +543,7 @@ RMAPI Vector2 RotateTowards(Vector2 from, Vector2 to, float maxRadians)
 }
 
 // Invert the given vector
-RMAPI Vector2 Invert(Vector2 v)
+RMAPI constexpr Vector2 Invert(Vector2 v)
 {
     Vector2 result = { 1.0f / v.x, 1.0f / v.y };
 
@@ -510,7 +603,7 @@ RMAPI bool Equals(Vector2 p, Vector2 q)
 //----------------------------------------------------------------------------------
 
 // Vector with components value 0.0f
-RMAPI Vector3 Vector3Zero(void)
+RMAPI constexpr Vector3 Vector3Zero(void)
 {
     Vector3 result = { 0.0f, 0.0f, 0.0f };
 
@@ -518,7 +611,7 @@ RMAPI Vector3 Vector3Zero(void)
 }
 
 // Vector with components value 1.0f
-RMAPI Vector3 Vector3One(void)
+RMAPI constexpr Vector3 Vector3One(void)
 {
     Vector3 result = { 1.0f, 1.0f, 1.0f };
 
@@ -526,7 +619,7 @@ RMAPI Vector3 Vector3One(void)
 }
 
 // Add two vectors
-RMAPI Vector3 Add(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Add(Vector3 v1, Vector3 v2)
 {
     Vector3 result = { v1.x + v2.x, v1.y + v2.y, v1.z + v2.z };
 
@@ -534,7 +627,7 @@ RMAPI Vector3 Add(Vector3 v1, Vector3 v2)
 }
 
 // Add vector and float value
-RMAPI Vector3 Add(Vector3 v, float add)
+RMAPI constexpr Vector3 Add(Vector3 v, float add)
 {
     Vector3 result = { v.x + add, v.y + add, v.z + add };
 
@@ -542,7 +635,7 @@ RMAPI Vector3 Add(Vector3 v, float add)
 }
 
 // Subtract two vectors
-RMAPI Vector3 Subtract(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Subtract(Vector3 v1, Vector3 v2)
 {
     Vector3 result = { v1.x - v2.x, v1.y - v2.y, v1.z - v2.z };
 
@@ -550,7 +643,7 @@ RMAPI Vector3 Subtract(Vector3 v1, Vector3 v2)
 }
 
 // Subtract vector by float value
-RMAPI Vector3 Subtract(Vector3 v, float sub)
+RMAPI constexpr Vector3 Subtract(Vector3 v, float sub)
 {
     Vector3 result = { v.x - sub, v.y - sub, v.z - sub };
 
@@ -558,7 +651,7 @@ RMAPI Vector3 Subtract(Vector3 v, float sub)
 }
 
 // Multiply vector by scalar
-RMAPI Vector3 Scale(Vector3 v, float scalar)
+RMAPI constexpr Vector3 Scale(Vector3 v, float scalar)
 {
     Vector3 result = { v.x * scalar, v.y * scalar, v.z * scalar };
 
@@ -566,7 +659,7 @@ RMAPI Vector3 Scale(Vector3 v, float scalar)
 }
 
 // Multiply vector by vector
-RMAPI Vector3 Multiply(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Multiply(Vector3 v1, Vector3 v2)
 {
     Vector3 result = { v1.x * v2.x, v1.y * v2.y, v1.z * v2.z };
 
@@ -574,7 +667,7 @@ RMAPI Vector3 Multiply(Vector3 v1, Vector3 v2)
 }
 
 // Calculate two vectors cross product
-RMAPI Vector3 Cross(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Cross(Vector3 v1, Vector3 v2)
 {
     Vector3 result = { v1.y * v2.z - v1.z * v2.y, v1.z * v2.x - v1.x * v2.z, v1.x * v2.y - v1.y * v2.x };
 
@@ -619,7 +712,7 @@ RMAPI float Length(const Vector3 v)
 }
 
 // Calculate vector square length
-RMAPI float LengthSqr(const Vector3 v)
+RMAPI constexpr float LengthSqr(const Vector3 v)
 {
     float result = v.x * v.x + v.y * v.y + v.z * v.z;
 
@@ -627,7 +720,7 @@ RMAPI float LengthSqr(const Vector3 v)
 }
 
 // Calculate two vectors dot product
-RMAPI float Dot(Vector3 v1, Vector3 v2)
+RMAPI constexpr float Dot(Vector3 v1, Vector3 v2)
 {
     float result = (v1.x * v2.x + v1.y * v2.y + v1.z * v2.z);
 
@@ -648,7 +741,7 @@ RMAPI float Distance(Vector3 v1, Vector3 v2)
 }
 
 // Calculate square distance between two vectors
-RMAPI float DistanceSqr(Vector3 v1, Vector3 v2)
+RMAPI constexpr float DistanceSqr(Vector3 v1, Vector3 v2)
 {
     float result = 0.0f;
 
@@ -661,14 +754,14 @@ RMAPI float DistanceSqr(Vector3 v1, Vector3 v2)
 }
 
 // Project v1 onto v2
-RMAPI Vector3 Project(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Project(Vector3 v1, Vector3 v2)
 {
     float t = Dot(v1, v2) / Dot(v2, v2);
     return { t * v2.x, t * v2.y, t * v2.z };
 }
 
 // Returns the point on line AB nearest to point P
-RMAPI Vector3 ProjectPointLine(Vector3 A, Vector3 B, Vector3 P)
+RMAPI constexpr Vector3 ProjectPointLine(Vector3 A, Vector3 B, Vector3 P)
 {
     Vector3 AB = Subtract(B, A);
     float t = Dot(Subtract(P, A), AB) / Dot(AB, AB);
@@ -689,7 +782,7 @@ RMAPI float Angle(Vector3 v1, Vector3 v2)
 }
 
 // Negate provided vector (invert direction)
-RMAPI Vector3 Negate(Vector3 v)
+RMAPI constexpr Vector3 Negate(Vector3 v)
 {
     Vector3 result = { -v.x, -v.y, -v.z };
 
@@ -697,7 +790,7 @@ RMAPI Vector3 Negate(Vector3 v)
 }
 
 // Divide vector by vector
-RMAPI Vector3 Divide(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Divide(Vector3 v1, Vector3 v2)
 {
     Vector3 result = { v1.x / v2.x, v1.y / v2.y, v1.z / v2.z };
 
@@ -755,9 +848,37 @@ RMAPI void OrthoNormalize(Vector3* v1, Vector3* v2)
     *v2 = vn2;
 }
 
+#if defined(MATH_SSE2)
+// Transforms a Vector3 by a given Matrix (SSE2 path of Multiply)
+RMAPI Vector3 MultiplySimd(Vector3 v, Matrix mat)
+{
+    Vector3 result = { 0 };
+
+    // Each matrix row in memory holds one output component, sum the row products horizontally
+    __m128 p = _mm_setr_ps(v.x, v.y, v.z, 1.0f);
+    __m128 rx = _mm_mul_ps(_mm_loadu_ps(&mat.m0), p);
+    __m128 ry = _mm_mul_ps(_mm_loadu_ps(&mat.m1), p);
+    __m128 rz = _mm_mul_ps(_mm_loadu_ps(&mat.m2), p);
+    __m128 rw = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(rx, ry, rz, rw);
+    float xyzw[4];
+    _mm_storeu_ps(xyzw, _mm_add_ps(_mm_add_ps(rx, ry), _mm_add_ps(rz, rw)));
+
+    result.x = xyzw[0];
+    result.y = xyzw[1];
+    result.z = xyzw[2];
+
+    return result;
+}
+#endif
+
 // Transforms a Vector3 by a given Matrix
-RMAPI Vector3 Multiply(Vector3 v, Matrix mat)
+RMAPI constexpr Vector3 Multiply(Vector3 v, Matrix mat)
 {
+#if defined(MATH_SSE2)
+    if (!std::is_constant_evaluated()) return MultiplySimd(v, mat);
+#endif
+
     Vector3 result = { 0 };
 
     float x = v.x;
@@ -836,7 +957,7 @@ RMAPI Vector3 Rotate(Vector3 v, Vector3 axis, float angle)
 }
 
 // Calculate linear interpolation between two vectors
-RMAPI Vector3 Lerp(Vector3 v1, Vector3 v2, float amount)
+RMAPI constexpr Vector3 Lerp(Vector3 v1, Vector3 v2, float amount)
 {
     Vector3 result = { 0 };
 
@@ -848,7 +969,7 @@ RMAPI Vector3 Lerp(Vector3 v1, Vector3 v2, float amount)
 }
 
 // Calculate reflected vector to normal
-RMAPI Vector3 Reflect(Vector3 v, Vector3 normal)
+RMAPI constexpr Vector3 Reflect(Vector3 v, Vector3 normal)
 {
     Vector3 result = { 0 };
 
@@ -891,7 +1012,7 @@ RMAPI Vector3 Max(Vector3 v1, Vector3 v2)
 
 // Compute barycenter coordinates (u, v, w) for point p with respect to triangle (a, b, c)
 // NOTE: Assumes P is on the plane of the triangle
-RMAPI Vector3 Barycenter(Vector3 p, Vector3 a, Vector3 b, Vector3 c)
+RMAPI constexpr Vector3 Barycenter(Vector3 p, Vector3 a, Vector3 b, Vector3 c)
 {
     Vector3 result = { 0 };
 
@@ -998,7 +1119,7 @@ RMAPI Vector3 Unproject(Vector3 source, Matrix projection, Matrix view)
 }
 
 // Get Vector3 as float array
-RMAPI float3 ToFloatV(Vector3 v)
+RMAPI constexpr float3 ToFloatV(Vector3 v)
 {
     float3 buffer = { 0 };
 
@@ -1010,7 +1131,7 @@ RMAPI float3 ToFloatV(Vector3 v)
 }
 
 // Invert the given vector
-RMAPI Vector3 Invert(Vector3 v)
+RMAPI constexpr Vector3 Invert(Vector3 v)
 {
     Vector3 result = { 1.0f / v.x, 1.0f / v.y, 1.0f / v.z };
 
@@ -1100,7 +1221,7 @@ RMAPI Vector3 Refract(Vector3 v, Vector3 n, float r)
 //----------------------------------------------------------------------------------
 
 // Compute matrix determinant
-RMAPI float Determinant(Matrix mat)
+RMAPI constexpr float Determinant(Matrix mat)
 {
     float result = 0.0f;
 
@@ -1121,7 +1242,7 @@ RMAPI float Determinant(Matrix mat)
 }
 
 // Get the trace of the matrix (sum of the values along the diagonal)
-RMAPI float Trace(Matrix mat)
+RMAPI constexpr float Trace(Matrix mat)
 {
     float result = (mat.m0 + mat.m5 + mat.m10 + mat.m15);
 
@@ -1129,7 +1250,7 @@ RMAPI float Trace(Matrix mat)
 }
 
 // Transposes provided matrix
-RMAPI Matrix Transpose(Matrix mat)
+RMAPI constexpr Matrix Transpose(Matrix mat)
 {
     Matrix result = { 0 };
 
@@ -1153,9 +1274,90 @@ RMAPI Matrix Transpose(Matrix mat)
     return result;
 }
 
+#if defined(MATH_SSE2)
+// 2x2 row major matrix product A*B, matrices packed as (m00, m01, m10, m11)
+RMAPI __m128 Mat2Mul(__m128 a, __m128 b)
+{
+    return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+        _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+// 2x2 row major adjugate product (A#)*B
+RMAPI __m128 Mat2AdjMul(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+        _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+}
+
+// 2x2 row major adjugate product A*(B#)
+RMAPI __m128 Mat2MulAdj(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+        _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+// Invert provided matrix (SSE2 path of Invert)
+RMAPI Matrix InvertSimd(Matrix mat)
+{
+    Matrix result = { 0 };
+
+    // Block-wise inversion over the four 2x2 sub-matrices
+    // Ref.: https://lxjk.github.io/2017/09/03/Fast-4x4-Matrix-Inverse-with-SSE-SIMD-Explained.html
+    __m128 r0 = _mm_loadu_ps(&mat.m0);
+    __m128 r1 = _mm_loadu_ps(&mat.m1);
+    __m128 r2 = _mm_loadu_ps(&mat.m2);
+    __m128 r3 = _mm_loadu_ps(&mat.m3);
+
+    __m128 A = _mm_movelh_ps(r0, r1);
+    __m128 B = _mm_movehl_ps(r1, r0);
+    __m128 C = _mm_movelh_ps(r2, r3);
+    __m128 D = _mm_movehl_ps(r3, r2);
+
+    // Sub-matrix determinants as (|A| |B| |C| |D|)
+    __m128 detSub = _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(3, 1, 3, 1))),
+        _mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(2, 0, 2, 0))));
+    __m128 detA = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(0, 0, 0, 0));
+    __m128 detB = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(1, 1, 1, 1));
+    __m128 detC = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(2, 2, 2, 2));
+    __m128 detD = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(3, 3, 3, 3));
+
+    __m128 D_C = Mat2AdjMul(D, C);
+    __m128 A_B = Mat2AdjMul(A, B);
+    __m128 X_ = _mm_sub_ps(_mm_mul_ps(detD, A), Mat2Mul(B, D_C));
+    __m128 W_ = _mm_sub_ps(_mm_mul_ps(detA, D), Mat2Mul(C, A_B));
+    __m128 Y_ = _mm_sub_ps(_mm_mul_ps(detB, C), Mat2MulAdj(D, A_B));
+    __m128 Z_ = _mm_sub_ps(_mm_mul_ps(detC, B), Mat2MulAdj(A, D_C));
+
+    // |M| = |A|*|D| + |B|*|C| - tr((A#B)(D#C))
+    __m128 tr = _mm_mul_ps(A_B, _mm_shuffle_ps(D_C, D_C, _MM_SHUFFLE(3, 1, 2, 0)));
+    tr = _mm_add_ps(tr, _mm_shuffle_ps(tr, tr, _MM_SHUFFLE(2, 3, 0, 1)));
+    tr = _mm_add_ps(tr, _mm_shuffle_ps(tr, tr, _MM_SHUFFLE(1, 0, 3, 2)));
+    __m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+
+    __m128 invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+    X_ = _mm_mul_ps(X_, invDet);
+    Y_ = _mm_mul_ps(Y_, invDet);
+    Z_ = _mm_mul_ps(Z_, invDet);
+    W_ = _mm_mul_ps(W_, invDet);
+
+    // Apply the adjugate shuffle while storing the rows
+    _mm_storeu_ps(&result.m0, _mm_shuffle_ps(X_, Y_, _MM_SHUFFLE(1, 3, 1, 3)));
+    _mm_storeu_ps(&result.m1, _mm_shuffle_ps(X_, Y_, _MM_SHUFFLE(0, 2, 0, 2)));
+    _mm_storeu_ps(&result.m2, _mm_shuffle_ps(Z_, W_, _MM_SHUFFLE(1, 3, 1, 3)));
+    _mm_storeu_ps(&result.m3, _mm_shuffle_ps(Z_, W_, _MM_SHUFFLE(0, 2, 0, 2)));
+
+    return result;
+}
+#endif
+
 // Invert provided matrix
-RMAPI Matrix Invert(Matrix mat)
+RMAPI constexpr Matrix Invert(Matrix mat)
 {
+#if defined(MATH_SSE2)
+    if (!std::is_constant_evaluated()) return InvertSimd(mat);
+#endif
+
     Matrix result = { 0 };
 
     // Cache the matrix values (speed optimization)
@@ -1201,7 +1403,7 @@ RMAPI Matrix Invert(Matrix mat)
 }
 
 // Get identity matrix
-RMAPI Matrix MatrixIdentity(void)
+RMAPI constexpr Matrix MatrixIdentity(void)
 {
     Matrix result = { 1.0f, 0.0f, 0.0f, 0.0f,
                       0.0f, 1.0f, 0.0f, 0.0f,
@@ -1212,7 +1414,7 @@ RMAPI Matrix MatrixIdentity(void)
 }
 
 // Add two matrices
-RMAPI Matrix Add(Matrix left, Matrix right)
+RMAPI constexpr Matrix Add(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
@@ -1237,7 +1439,7 @@ RMAPI Matrix Add(Matrix left, Matrix right)
 }
 
 // Subtract two matrices (left - right)
-RMAPI Matrix Subtract(Matrix left, Matrix right)
+RMAPI constexpr Matrix Subtract(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
@@ -1261,10 +1463,60 @@ RMAPI Matrix Subtract(Matrix left, Matrix right)
     return result;
 }
 
+#if defined(MATH_SSE2) || defined(MATH_NEON)
+// Get two matrix multiplication (SIMD path of Multiply)
+RMAPI Matrix MultiplySimd(Matrix left, Matrix right)
+{
+    Matrix result = { 0 };
+
+    // NOTE: Each struct row in memory (m0 m4 m8 m12, m1 ...) is a linear combination of the rows of left
+#if defined(MATH_SSE2)
+    __m128 l0 = _mm_loadu_ps(&left.m0);
+    __m128 l1 = _mm_loadu_ps(&left.m1);
+    __m128 l2 = _mm_loadu_ps(&left.m2);
+    __m128 l3 = _mm_loadu_ps(&left.m3);
+    const float* r = &right.m0;
+    float* out = &result.m0;
+
+    for (int i = 0; i < 4; i++)
+    {
+        __m128 row = _mm_mul_ps(_mm_set1_ps(r[i * 4 + 0]), l0);
+        row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(r[i * 4 + 1]), l1));
+        row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(r[i * 4 + 2]), l2));
+        row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(r[i * 4 + 3]), l3));
+        _mm_storeu_ps(out + i * 4, row);
+    }
+#elif defined(MATH_NEON)
+    float32x4_t l0 = vld1q_f32(&left.m0);
+    float32x4_t l1 = vld1q_f32(&left.m1);
+    float32x4_t l2 = vld1q_f32(&left.m2);
+    float32x4_t l3 = vld1q_f32(&left.m3);
+    const float* r = &right.m0;
+    float* out = &result.m0;
+
+    for (int i = 0; i < 4; i++)
+    {
+        float32x4_t w = vld1q_f32(r + i * 4);
+        float32x4_t row = vmulq_laneq_f32(l0, w, 0);
+        row = vfmaq_laneq_f32(row, l1, w, 1);
+        row = vfmaq_laneq_f32(row, l2, w, 2);
+        row = vfmaq_laneq_f32(row, l3, w, 3);
+        vst1q_f32(out + i * 4, row);
+    }
+#endif
+
+    return result;
+}
+#endif
+
 // Get two matrix multiplication
 // NOTE: When multiplying matrices... the order matters!
-RMAPI Matrix Multiply(Matrix left, Matrix right)
+RMAPI constexpr Matrix Multiply(Matrix left, Matrix right)
 {
+#if defined(MATH_SSE2) || defined(MATH_NEON)
+    if (!std::is_constant_evaluated()) return MultiplySimd(left, right);
+#endif
+
     Matrix result = { 0 };
 
     result.m0 = left.m0 * right.m0 + left.m1 * right.m4 + left.m2 * right.m8 + left.m3 * right.m12;
@@ -1288,7 +1540,7 @@ RMAPI Matrix Multiply(Matrix left, Matrix right)
 }
 
 // Get translation matrix
-RMAPI Matrix Translate(float x, float y, float z)
+RMAPI constexpr Matrix Translate(float x, float y, float z)
 {
     Matrix result = { 1.0f, 0.0f, 0.0f, x,
                       0.0f, 1.0f, 0.0f, y,
@@ -1472,7 +1724,7 @@ RMAPI Matrix RotateZYX(Vector3 angle)
 }
 
 // Get scaling matrix
-RMAPI Matrix Scale(float x, float y, float z)
+RMAPI constexpr Matrix Scale(float x, float y, float z)
 {
     Matrix result = { x, 0.0f, 0.0f, 0.0f,
                       0.0f, y, 0.0f, 0.0f,
@@ -1483,7 +1735,7 @@ RMAPI Matrix Scale(float x, float y, float z)
 }
 
 // Get perspective projection matrix
-RMAPI Matrix Frustum(double left, double right, double bottom, double top, double near, double far)
+RMAPI constexpr Matrix Frustum(double left, double right, double bottom, double top, double near, double far)
 {
     Matrix result = { 0 };
 
@@ -1542,7 +1794,7 @@ RMAPI Matrix Perspective(double fovy, double aspect, double near, double far)
 }
 
 // Get orthographic projection matrix
-RMAPI Matrix Ortho(double left, double right, double bottom, double top, double near, double far)
+RMAPI constexpr Matrix Ortho(double left, double right, double bottom, double top, double near, double far)
 {
     Matrix result = { 0 };
 
@@ -1626,7 +1878,7 @@ RMAPI Matrix LookAt(Vector3 eye, Vector3 target, Vector3 up)
 }
 
 // Get float array of matrix data
-RMAPI float16 ToFloatV(Matrix mat)
+RMAPI constexpr float16 ToFloatV(Matrix mat)
 {
     float16 result = { 0 };
 
@@ -1655,7 +1907,7 @@ RMAPI float16 ToFloatV(Matrix mat)
 //----------------------------------------------------------------------------------
 
 // Add two quaternions
-RMAPI Quaternion Add(Quaternion q1, Quaternion q2)
+RMAPI constexpr Quaternion Add(Quaternion q1, Quaternion q2)
 {
     Quaternion result = { q1.x + q2.x, q1.y + q2.y, q1.z + q2.z, q1.w + q2.w };
 
@@ -1663,7 +1915,7 @@ RMAPI Quaternion Add(Quaternion q1, Quaternion q2)
 }
 
 // Add quaternion and float value
-RMAPI Quaternion Add(Quaternion q, float add)
+RMAPI constexpr Quaternion Add(Quaternion q, float add)
 {
     Quaternion result = { q.x + add, q.y + add, q.z + add, q.w + add };
 
@@ -1671,7 +1923,7 @@ RMAPI Quaternion Add(Quaternion q, float add)
 }
 
 // Subtract two quaternions
-RMAPI Quaternion Subtract(Quaternion q1, Quaternion q2)
+RMAPI constexpr Quaternion Subtract(Quaternion q1, Quaternion q2)
 {
     Quaternion result = { q1.x - q2.x, q1.y - q2.y, q1.z - q2.z, q1.w - q2.w };
 
@@ -1679,7 +1931,7 @@ RMAPI Quaternion Subtract(Quaternion q1, Quaternion q2)
 }
 
 // Subtract quaternion and float value
-RMAPI Quaternion Subtract(Quaternion q, float sub)
+RMAPI constexpr Quaternion Subtract(Quaternion q, float sub)
 {
     Quaternion result = { q.x - sub, q.y - sub, q.z - sub, q.w - sub };
 
@@ -1687,7 +1939,7 @@ RMAPI Quaternion Subtract(Quaternion q, float sub)
 }
 
 // Get identity quaternion
-RMAPI Quaternion QuaternionIdentity(void)
+RMAPI constexpr Quaternion QuaternionIdentity(void)
 {
     Quaternion result = { 0.0f, 0.0f, 0.0f, 1.0f };
 
@@ -1720,7 +1972,7 @@ RMAPI Quaternion Normalize(Quaternion q)
 }
 
 // Invert provided quaternion
-RMAPI Quaternion Invert(Quaternion q)
+RMAPI constexpr Quaternion Invert(Quaternion q)
 {
     Quaternion result = q;
 
@@ -1740,7 +1992,7 @@ RMAPI Quaternion Invert(Quaternion q)
 }
 
 // Calculate two quaternion multiplication
-RMAPI Quaternion Multiply(Quaternion q1, Quaternion q2)
+RMAPI constexpr Quaternion Multiply(Quaternion q1, Quaternion q2)
 {
     Quaternion result = { 0 };
 
@@ -1756,7 +2008,7 @@ RMAPI Quaternion Multiply(Quaternion q1, Quaternion q2)
 }
 
 // Scale quaternion by float value
-RMAPI Quaternion Scale(Quaternion q, float mul)
+RMAPI constexpr Quaternion Scale(Quaternion q, float mul)
 {
     Quaternion result = { 0 };
 
@@ -1769,7 +2021,7 @@ RMAPI Quaternion Scale(Quaternion q, float mul)
 }
 
 // Divide two quaternions
-RMAPI Quaternion Divide(Quaternion q1, Quaternion q2)
+RMAPI constexpr Quaternion Divide(Quaternion q1, Quaternion q2)
 {
     Quaternion result = { q1.x / q2.x, q1.y / q2.y, q1.z / q2.z, q1.w / q2.w };
 
@@ -1777,7 +2029,7 @@ RMAPI Quaternion Divide(Quaternion q1, Quaternion q2)
 }
 
 // Calculate linear interpolation between two quaternions
-RMAPI Quaternion Lerp(Quaternion q1, Quaternion q2, float amount)
+RMAPI constexpr Quaternion Lerp(Quaternion q1, Quaternion q2, float amount)
 {
     Quaternion result = { 0 };
 
@@ -1949,7 +2201,7 @@ RMAPI Quaternion FromMatrix(Matrix mat)
 }
 
 // Get a matrix for a given quaternion
-RMAPI Matrix ToMatrix(Quaternion q)
+RMAPI constexpr Matrix ToMatrix(Quaternion q)
 {
     Matrix result = { 1.0f, 0.0f, 0.0f, 0.0f,
                       0.0f, 1.0f, 0.0f, 0.0f,
@@ -2111,7 +2363,7 @@ RMAPI Vector3 ToEuler(Quaternion q)
 }
 
 // Transform a quaternion given a transformation matrix
-RMAPI Quaternion Multiply(Quaternion q, Matrix mat)
+RMAPI constexpr Quaternion Multiply(Quaternion q, Matrix mat)
 {
     Quaternion result = { 0 };
 
@@ -2138,141 +2390,317 @@ RMAPI int Equals(Quaternion p, Quaternion q)
     return result;
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Aabb math
+//----------------------------------------------------------------------------------
+
+// Get the bounds of a rectangle given by its top-left corner and size
+RMAPI constexpr Aabb ToAabb(float x, float y, float width, float height)
+{
+    Aabb result = { { x, y }, { x + width, y + height } };
+
+    return result;
+}
+
+// Check if two boxes overlap (touching edges count as overlap)
+RMAPI constexpr bool Overlaps(Aabb a, Aabb b)
+{
+    bool result = (a.min.x <= b.max.x) && (a.max.x >= b.min.x) &&
+        (a.min.y <= b.max.y) && (a.max.y >= b.min.y);
+
+    return result;
+}
+
+// Check if a point is inside the box
+RMAPI constexpr bool Contains(Aabb box, Vector2 p)
+{
+    bool result = (p.x >= box.min.x) && (p.x <= box.max.x) &&
+        (p.y >= box.min.y) && (p.y <= box.max.y);
+
+    return result;
+}
+
+// Check if inner lies completely inside outer
+RMAPI constexpr bool Contains(Aabb outer, Aabb inner)
+{
+    bool result = (inner.min.x >= outer.min.x) && (inner.max.x <= outer.max.x) &&
+        (inner.min.y >= outer.min.y) && (inner.max.y <= outer.max.y);
+
+    return result;
+}
+
+// Get the smallest box enclosing both boxes
+RMAPI constexpr Aabb Merge(Aabb a, Aabb b)
+{
+    Aabb result = { 0 };
+
+    result.min.x = (a.min.x < b.min.x)? a.min.x : b.min.x;
+    result.min.y = (a.min.y < b.min.y)? a.min.y : b.min.y;
+    result.max.x = (a.max.x > b.max.x)? a.max.x : b.max.x;
+    result.max.y = (a.max.y > b.max.y)? a.max.y : b.max.y;
+
+    return result;
+}
+
+// Calculate box perimeter (surface area heuristic cost in 2D)
+RMAPI constexpr float Perimeter(Aabb box)
+{
+    float result = 2.0f * ((box.max.x - box.min.x) + (box.max.y - box.min.y));
+
+    return result;
+}
+
+// Get the point of the box closest to p (p itself when inside)
+RMAPI constexpr Vector2 ClosestPoint(Aabb box, Vector2 p)
+{
+    Vector2 result = { 0 };
+
+    result.x = (p.x < box.min.x)? box.min.x : ((p.x > box.max.x)? box.max.x : p.x);
+    result.y = (p.y < box.min.y)? box.min.y : ((p.y > box.max.y)? box.max.y : p.y);
+
+    return result;
+}
+
+// Calculate square distance from a point to the box (0 when inside)
+RMAPI constexpr float DistanceSqr(Aabb box, Vector2 p)
+{
+    float result = DistanceSqr(ClosestPoint(box, p), p);
+
+    return result;
+}
+
+// Grow the box by amount on every side
+RMAPI constexpr Aabb Inflate(Aabb box, float amount)
+{
+    Aabb result = { { box.min.x - amount, box.min.y - amount }, { box.max.x + amount, box.max.y + amount } };
+
+    return result;
+}
+
+// Check if the segment from start to end crosses the box (slab test)
+RMAPI bool SegmentOverlaps(Aabb box, Vector2 start, Vector2 end)
+{
+    float tmin = 0.0f;
+    float tmax = 1.0f;
+    float d[2] = { end.x - start.x, end.y - start.y };
+    float s[2] = { start.x, start.y };
+    float lo[2] = { box.min.x, box.min.y };
+    float hi[2] = { box.max.x, box.max.y };
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (fabsf(d[i]) < EPSILON)
+        {
+            if ((s[i] < lo[i]) || (s[i] > hi[i])) return false;
+        }
+        else
+        {
+            float inv = 1.0f / d[i];
+            float t1 = (lo[i] - s[i]) * inv;
+            float t2 = (hi[i] - s[i]) * inv;
+            if (t1 > t2) { float t = t1; t1 = t2; t2 = t; }
+            if (t1 > tmin) tmin = t1;
+            if (t2 < tmax) tmax = t2;
+            if (tmin > tmax) return false;
+        }
+    }
+
+    return true;
+}
+
+// Check if the segment from start to end, thickened by radius (a capsule), touches the box
+// NOTE: Exact test against the box rounded by radius: two inflated slabs plus the four corner circles
+RMAPI bool SegmentOverlaps(Aabb box, Vector2 start, Vector2 end, float radius)
+{
+    if (radius <= 0.0f) return SegmentOverlaps(box, start, end);
+    if (DistanceSqr(start, end) < EPSILON) return DistanceSqr(box, start) <= radius * radius;
+
+    Aabb wide = { { box.min.x - radius, box.min.y }, { box.max.x + radius, box.max.y } };
+    Aabb tall = { { box.min.x, box.min.y - radius }, { box.max.x, box.max.y + radius } };
+    if (SegmentOverlaps(wide, start, end) || SegmentOverlaps(tall, start, end)) return true;
+
+    float radiusSqr = radius * radius;
+    Vector2 corners[4] = { box.min, { box.max.x, box.min.y }, box.max, { box.min.x, box.max.y } };
+
+    for (int i = 0; i < 4; i++)
+    {
+        if (DistanceSqr(ProjectPointLine(start, end, corners[i]), corners[i]) <= radiusSqr) return true;
+    }
+
+    return false;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Global operator overloads
 //----------------------------------------------------------------------------------
 
-RMAPI Vector2 operator+(const Vector2& a, const Vector2& b)
+RMAPI constexpr Vector2 operator+(const Vector2& a, const Vector2& b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector2 operator-(const Vector2& a, const Vector2& b)
+RMAPI constexpr Vector2 operator-(const Vector2& a, const Vector2& b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector2 operator*(const Vector2& a, const Vector2& b)
+RMAPI constexpr Vector2 operator*(const Vector2& a, const Vector2& b)
 {
     return Multiply(a, b);
 }
 
-RMAPI Vector2 operator/(const Vector2& a, const Vector2& b)
+RMAPI constexpr Vector2 operator/(const Vector2& a, const Vector2& b)
 {
     return Divide(a, b);
 }
 
-RMAPI Vector2 operator+(const Vector2& a, float b)
+RMAPI constexpr Vector2 operator+(const Vector2& a, float b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector2 operator-(const Vector2& a, float b)
+RMAPI constexpr Vector2 operator-(const Vector2& a, float b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector2 operator*(const Vector2& a, float b)
+RMAPI constexpr Vector2 operator*(const Vector2& a, float b)
 {
     return Scale(a, b);
 }
 
-RMAPI Vector3 operator+(const Vector3& a, const Vector3& b)
+RMAPI constexpr Vector3 operator+(const Vector3& a, const Vector3& b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector3 operator-(const Vector3& a, const Vector3& b)
+RMAPI constexpr Vector3 operator-(const Vector3& a, const Vector3& b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector3 operator*(const Vector3& a, const Vector3& b)
+RMAPI constexpr Vector3 operator*(const Vector3& a, const Vector3& b)
 {
     return Multiply(a, b);
 }
 
-RMAPI Vector3 operator/(const Vector3& a, const Vector3& b)
+RMAPI constexpr Vector3 operator/(const Vector3& a, const Vector3& b)
 {
     return Divide(a, b);
 }
 
-RMAPI Vector3 operator+(const Vector3& a, float b)
+RMAPI constexpr Vector3 operator+(const Vector3& a, float b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector3 operator-(const Vector3& a, float b)
+RMAPI constexpr Vector3 operator-(const Vector3& a, float b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector3 operator*(const Vector3& a, float b)
+RMAPI constexpr Vector3 operator*(const Vector3& a, float b)
 {
     return Scale(a, b);
 }
 
-RMAPI Vector3 operator/(const Vector3& a, float b)
+RMAPI constexpr Vector3 operator/(const Vector3& a, float b)
 {
     return Scale(a, 1.0f / b);
 }
 
-RMAPI Vector4 operator+(const Vector4& a, const Vector4& b)
+RMAPI constexpr Vector4 operator+(const Vector4& a, const Vector4& b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector4 operator-(const Vector4& a, const Vector4& b)
+RMAPI constexpr Vector4 operator-(const Vector4& a, const Vector4& b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector4 operator*(const Vector4& a, const Vector4& b)
+RMAPI constexpr Vector4 operator*(const Vector4& a, const Vector4& b)
 {
     return Multiply(a, b);
 }
 
-RMAPI Vector4 operator/(const Vector4& a, const Vector4& b)
+RMAPI constexpr Vector4 operator/(const Vector4& a, const Vector4& b)
 {
     return Divide(a, b);
 }
 
-RMAPI Vector4 operator+(const Vector4& a, float b)
+RMAPI constexpr Vector4 operator+(const Vector4& a, float b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector4 operator-(const Vector4& a, float b)
+RMAPI constexpr Vector4 operator-(const Vector4& a, float b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector4 operator*(const Vector4& a, float b)
+RMAPI constexpr Vector4 operator*(const Vector4& a, float b)
 {
     return Scale(a, b);
 }
 
-RMAPI Vector4 operator/(const Vector4& a, float b)
+RMAPI constexpr Vector4 operator/(const Vector4& a, float b)
 {
     return Scale(a, 1.0f / b);
 }
 
-RMAPI Vector2 operator/(const Vector2& a, float b)
+RMAPI constexpr Vector2 operator/(const Vector2& a, float b)
 {
     return Scale(a, 1.0f / b);
 }
 
-RMAPI Matrix operator+(const Matrix& a, const Matrix& b)
+RMAPI constexpr Matrix operator+(const Matrix& a, const Matrix& b)
 {
     return Add(a, b);
 }
 
-RMAPI Matrix operator-(const Matrix& a, const Matrix& b)
+RMAPI constexpr Matrix operator-(const Matrix& a, const Matrix& b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Matrix operator*(const Matrix& a, const Matrix& b)
+RMAPI constexpr Matrix operator*(const Matrix& a, const Matrix& b)
 {
     return Multiply(a, b);
 }
+
+//----------------------------------------------------------------------------------
+// Compile-time tests
+//----------------------------------------------------------------------------------
+
+static_assert(Clamp(2.0f, 0.0f, 1.0f) == 1.0f, "Clamp");
+static_assert(Lerp(0.0f, 10.0f, 0.5f) == 5.0f, "Lerp");
+static_assert(Remap(5.0f, 0.0f, 10.0f, 0.0f, 100.0f) == 50.0f, "Remap");
+static_assert(Sign(-3.0f) == -1.0f, "Sign");
+
+static_assert(Dot(Vector2{ 1.0f, 2.0f }, Vector2{ 3.0f, 4.0f }) == 11.0f, "Vector2 Dot");
+static_assert(Cross(Vector2{ 1.0f, 0.0f }, Vector2{ 0.0f, 1.0f }) == 1.0f, "Vector2 Cross");
+static_assert(DistanceSqr(Vector2{ 1.0f, 1.0f }, Vector2{ 4.0f, 5.0f }) == 25.0f, "Vector2 DistanceSqr");
+static_assert(ProjectPointLine(Vector2{ 0.0f, 0.0f }, Vector2{ 10.0f, 0.0f }, Vector2{ 4.0f, 3.0f }).x == 4.0f, "Vector2 ProjectPointLine");
+static_assert(ProjectPointLine(Vector2{ 0.0f, 0.0f }, Vector2{ 10.0f, 0.0f }, Vector2{ 12.0f, 3.0f }).x == 10.0f, "Vector2 ProjectPointLine clamp");
+static_assert((Vector2{ 1.0f, 2.0f } + Vector2{ 3.0f, 4.0f }).y == 6.0f, "Vector2 operator+");
+
+static_assert(Cross(Vector3{ 1.0f, 0.0f, 0.0f }, Vector3{ 0.0f, 1.0f, 0.0f }).z == 1.0f, "Vector3 Cross");
+static_assert(Dot(Vector3{ 1.0f, 2.0f, 3.0f }, Vector3{ 4.0f, 5.0f, 6.0f }) == 32.0f, "Vector3 Dot");
+static_assert(Reflect(Vector3{ 1.0f, -1.0f, 0.0f }, Vector3{ 0.0f, 1.0f, 0.0f }).y == 1.0f, "Vector3 Reflect");
+static_assert((Vector3{ 2.0f, 4.0f, 6.0f } * 0.5f).z == 3.0f, "Vector3 operator*");
+
+static_assert(Multiply(Vector3{ 1.0f, 2.0f, 3.0f }, Translate(1.0f, 2.0f, 3.0f)).z == 6.0f, "Vector3 Multiply Matrix");
+static_assert(Multiply(MatrixIdentity(), Translate(1.0f, 2.0f, 3.0f)).m13 == 2.0f, "Matrix Multiply identity");
+static_assert(Multiply(Scale(2.0f, 2.0f, 2.0f), Translate(1.0f, 0.0f, 0.0f)).m12 == 1.0f, "Matrix Multiply order");
+static_assert(Invert(Translate(1.0f, 2.0f, 3.0f)).m14 == -3.0f, "Matrix Invert");
+static_assert(Determinant(Scale(2.0f, 3.0f, 4.0f)) == 24.0f, "Matrix Determinant");
+static_assert(Transpose(Translate(1.0f, 2.0f, 3.0f)).m3 == 1.0f, "Matrix Transpose");
+
+static_assert(Multiply(QuaternionIdentity(), Quaternion{ 0.0f, 1.0f, 0.0f, 0.0f }).y == 1.0f, "Quaternion Multiply");
+static_assert(ToMatrix(QuaternionIdentity()).m10 == 1.0f, "Quaternion ToMatrix");
+
+static_assert(Overlaps(ToAabb(0.0f, 0.0f, 2.0f, 2.0f), ToAabb(2.0f, 1.0f, 1.0f, 1.0f)), "Aabb Overlaps");
+static_assert(!Contains(ToAabb(0.0f, 0.0f, 2.0f, 2.0f), Vector2{ 3.0f, 1.0f }), "Aabb Contains");
+static_assert(DistanceSqr(ToAabb(0.0f, 0.0f, 2.0f, 2.0f), Vector2{ 5.0f, 6.0f }) == 25.0f, "Aabb DistanceSqr");
+static_assert(Perimeter(Merge(ToAabb(0.0f, 0.0f, 1.0f, 1.0f), ToAabb(2.0f, 2.0f, 1.0f, 1.0f))) == 12.0f, "Aabb Merge");
@@ -0,0 +1,616 @@
+#pragma once
+#include "Math.h"
+
+// Batch variants of the Math.h vector functions.
+// Each kernel processes count elements of contiguous arrays using SSE2/AVX2 or NEON
+// when available (see MATH_SSE2, MATH_AVX2 and MATH_NEON in Math.h), with a scalar tail.
+// NOTE: out may alias any of the inputs, all operations are element-wise
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+#if defined(MATH_SSE2)
+#define MATH_SIMD4
+typedef __m128 float4;      // 4 float lanes
+typedef __m128 mask4;       // 4 lane mask (all bits set where true)
+#elif defined(MATH_NEON)
+#define MATH_SIMD4
+typedef float32x4_t float4;
+typedef uint32x4_t mask4;
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - 4-lane helpers
+//----------------------------------------------------------------------------------
+#if defined(MATH_SSE2)
+RMAPI float4 Load4(const float* p) { return _mm_loadu_ps(p); }
+RMAPI void Store4(float* p, float4 v) { _mm_storeu_ps(p, v); }
+RMAPI float4 Set4(float v) { return _mm_set1_ps(v); }
+RMAPI float4 Add4(float4 a, float4 b) { return _mm_add_ps(a, b); }
+RMAPI float4 Sub4(float4 a, float4 b) { return _mm_sub_ps(a, b); }
+RMAPI float4 Mul4(float4 a, float4 b) { return _mm_mul_ps(a, b); }
+RMAPI float4 Div4(float4 a, float4 b) { return _mm_div_ps(a, b); }
+RMAPI float4 Sqrt4(float4 v) { return _mm_sqrt_ps(v); }
+RMAPI float4 Min4(float4 a, float4 b) { return _mm_min_ps(a, b); }
+RMAPI float4 Max4(float4 a, float4 b) { return _mm_max_ps(a, b); }
+RMAPI mask4 Greater4(float4 a, float4 b) { return _mm_cmpgt_ps(a, b); }
+RMAPI mask4 LessEqual4(float4 a, float4 b) { return _mm_cmple_ps(a, b); }
+RMAPI mask4 And4(mask4 a, mask4 b) { return _mm_and_ps(a, b); }
+RMAPI mask4 Or4(mask4 a, mask4 b) { return _mm_or_ps(a, b); }
+RMAPI int MoveMask4(mask4 m) { return _mm_movemask_ps(m); }
+
+// Per lane (m ? a : b)
+RMAPI float4 Select4(mask4 m, float4 a, float4 b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+#elif defined(MATH_NEON)
+RMAPI float4 Load4(const float* p) { return vld1q_f32(p); }
+RMAPI void Store4(float* p, float4 v) { vst1q_f32(p, v); }
+RMAPI float4 Set4(float v) { return vdupq_n_f32(v); }
+RMAPI float4 Add4(float4 a, float4 b) { return vaddq_f32(a, b); }
+RMAPI float4 Sub4(float4 a, float4 b) { return vsubq_f32(a, b); }
+RMAPI float4 Mul4(float4 a, float4 b) { return vmulq_f32(a, b); }
+RMAPI float4 Div4(float4 a, float4 b) { return vdivq_f32(a, b); }
+RMAPI float4 Sqrt4(float4 v) { return vsqrtq_f32(v); }
+RMAPI float4 Min4(float4 a, float4 b) { return vminq_f32(a, b); }
+RMAPI float4 Max4(float4 a, float4 b) { return vmaxq_f32(a, b); }
+RMAPI mask4 Greater4(float4 a, float4 b) { return vcgtq_f32(a, b); }
+RMAPI mask4 LessEqual4(float4 a, float4 b) { return vcleq_f32(a, b); }
+RMAPI mask4 And4(mask4 a, mask4 b) { return vandq_u32(a, b); }
+RMAPI mask4 Or4(mask4 a, mask4 b) { return vorrq_u32(a, b); }
+
+// Bit i set if lane i of the mask is set
+RMAPI int MoveMask4(mask4 m)
+{
+    static const int32_t shifts[4] = { 0, 1, 2, 3 };
+    uint32x4_t bits = vshlq_u32(vshrq_n_u32(m, 31), vld1q_s32(shifts));
+    return (int)vaddvq_u32(bits);
+}
+
+// Per lane (m ? a : b)
+RMAPI float4 Select4(mask4 m, float4 a, float4 b) { return vbslq_f32(m, a, b); }
+#endif
+
+#if defined(MATH_SIMD4)
+// Index of the lowest set lane in a MoveMask4 result (mask must not be 0)
+RMAPI int LowestLane4(int mask)
+{
+    static const int lanes[16] = { 0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0 };
+    return lanes[mask & 15];
+}
+
+// Reciprocal of each lane, or 0 where the lane is not above zero
+RMAPI float4 SafeReciprocal4(float4 v)
+{
+    return Select4(Greater4(v, Set4(0.0f)), Div4(Set4(1.0f), v), Set4(0.0f));
+}
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Float array math
+//----------------------------------------------------------------------------------
+
+// Add two float arrays (out[i] = a[i] + b[i])
+RMAPI void AddFloats(const float* a, const float* b, float* out, int count)
+{
+    int i = 0;
+
+#if defined(MATH_AVX2)
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+#endif
+#if defined(MATH_SSE2)
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+#elif defined(MATH_NEON)
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(out + i, vaddq_f32(vld1q_f32(a + i), vld1q_f32(b + i)));
+#endif
+
+    for (; i < count; i++) out[i] = a[i] + b[i];
+}
+
+// Subtract two float arrays (out[i] = a[i] - b[i])
+RMAPI void SubtractFloats(const float* a, const float* b, float* out, int count)
+{
+    int i = 0;
+
+#if defined(MATH_AVX2)
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+#endif
+#if defined(MATH_SSE2)
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(out + i, _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+#elif defined(MATH_NEON)
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(out + i, vsubq_f32(vld1q_f32(a + i), vld1q_f32(b + i)));
+#endif
+
+    for (; i < count; i++) out[i] = a[i] - b[i];
+}
+
+// Scale float array (out[i] = a[i] * scale)
+RMAPI void ScaleFloats(const float* a, float scale, float* out, int count)
+{
+    int i = 0;
+
+#if defined(MATH_AVX2)
+    __m256 s8 = _mm256_set1_ps(scale);
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_loadu_ps(a + i), s8));
+#endif
+#if defined(MATH_SSE2)
+    __m128 s4 = _mm_set1_ps(scale);
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_loadu_ps(a + i), s4));
+#elif defined(MATH_NEON)
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(out + i, vmulq_n_f32(vld1q_f32(a + i), scale));
+#endif
+
+    for (; i < count; i++) out[i] = a[i] * scale;
+}
+
+// Add scaled float array (out[i] = a[i] + b[i] * scale)
+RMAPI void AddScaledFloats(const float* a, const float* b, float scale, float* out, int count)
+{
+    int i = 0;
+
+#if defined(MATH_AVX2)
+    __m256 s8 = _mm256_set1_ps(scale);
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_mul_ps(_mm256_loadu_ps(b + i), s8)));
+#endif
+#if defined(MATH_SSE2)
+    __m128 s4 = _mm_set1_ps(scale);
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_mul_ps(_mm_loadu_ps(b + i), s4)));
+#elif defined(MATH_NEON)
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(out + i, vmlaq_n_f32(vld1q_f32(a + i), vld1q_f32(b + i), scale));
+#endif
+
+    for (; i < count; i++) out[i] = a[i] + b[i] * scale;
+}
+
+// Linear interpolation between two float arrays (out[i] = a[i] + amount * (b[i] - a[i]))
+RMAPI void LerpFloats(const float* a, const float* b, float amount, float* out, int count)
+{
+    int i = 0;
+
+#if defined(MATH_AVX2)
+    __m256 t8 = _mm256_set1_ps(amount);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 va = _mm256_loadu_ps(a + i);
+        __m256 vb = _mm256_loadu_ps(b + i);
+        _mm256_storeu_ps(out + i, _mm256_add_ps(va, _mm256_mul_ps(t8, _mm256_sub_ps(vb, va))));
+    }
+#endif
+#if defined(MATH_SSE2)
+    __m128 t4 = _mm_set1_ps(amount);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 va = _mm_loadu_ps(a + i);
+        __m128 vb = _mm_loadu_ps(b + i);
+        _mm_storeu_ps(out + i, _mm_add_ps(va, _mm_mul_ps(t4, _mm_sub_ps(vb, va))));
+    }
+#elif defined(MATH_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t va = vld1q_f32(a + i);
+        float32x4_t vb = vld1q_f32(b + i);
+        vst1q_f32(out + i, vmlaq_n_f32(va, vsubq_f32(vb, va), amount));
+    }
+#endif
+
+    for (; i < count; i++) out[i] = a[i] + amount * (b[i] - a[i]);
+}
+
+#if defined(MATH_SSE2)
+// Split 4 packed Vector3 (x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3) into x, y and z lanes
+RMAPI void Deinterleave3(__m128 a, __m128 b, __m128 c, __m128* x, __m128* y, __m128* z)
+{
+    *x = _mm_shuffle_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 0, 0)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+    *y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    *z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+// Pack x, y and z lanes into 4 Vector3 (inverse of Deinterleave3)
+RMAPI void Interleave3(__m128 x, __m128 y, __m128 z, __m128* a, __m128* b, __m128* c)
+{
+    *a = _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    *b = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+    *c = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+#endif
+
+#if defined(MATH_SIMD4)
+// Load 4 consecutive Vector3 as x, y and z lanes
+RMAPI void Load3x4(const Vector3* v, float4* x, float4* y, float4* z)
+{
+#if defined(MATH_SSE2)
+    const float* p = &v->x;
+    Deinterleave3(_mm_loadu_ps(p), _mm_loadu_ps(p + 4), _mm_loadu_ps(p + 8), x, y, z);
+#else
+    float32x4x3_t xyz = vld3q_f32(&v->x);
+    *x = xyz.val[0];
+    *y = xyz.val[1];
+    *z = xyz.val[2];
+#endif
+}
+
+// Store x, y and z lanes as 4 consecutive Vector3
+RMAPI void Store3x4(Vector3* v, float4 x, float4 y, float4 z)
+{
+#if defined(MATH_SSE2)
+    float* p = &v->x;
+    __m128 a, b, c;
+    Interleave3(x, y, z, &a, &b, &c);
+    _mm_storeu_ps(p, a);
+    _mm_storeu_ps(p + 4, b);
+    _mm_storeu_ps(p + 8, c);
+#else
+    float32x4x3_t xyz = { { x, y, z } };
+    vst3q_f32(&v->x, xyz);
+#endif
+}
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Vector2 batch math
+//----------------------------------------------------------------------------------
+
+// Add two vector arrays (out[i] = v1[i] + v2[i])
+RMAPI void Add(const Vector2* v1, const Vector2* v2, Vector2* out, int count)
+{
+    AddFloats(&v1->x, &v2->x, &out->x, count * 2);
+}
+
+// Subtract two vector arrays (out[i] = v1[i] - v2[i])
+RMAPI void Subtract(const Vector2* v1, const Vector2* v2, Vector2* out, int count)
+{
+    SubtractFloats(&v1->x, &v2->x, &out->x, count * 2);
+}
+
+// Scale vector array (out[i] = v[i] * scale)
+RMAPI void Scale(const Vector2* v, float scale, Vector2* out, int count)
+{
+    ScaleFloats(&v->x, scale, &out->x, count * 2);
+}
+
+// Add scaled vector array, ie integrate positions by velocities (out[i] = v[i] + dir[i] * scale)
+RMAPI void AddScaled(const Vector2* v, const Vector2* dir, float scale, Vector2* out, int count)
+{
+    AddScaledFloats(&v->x, &dir->x, scale, &out->x, count * 2);
+}
+
+// Calculate linear interpolation between two vector arrays
+RMAPI void Lerp(const Vector2* v1, const Vector2* v2, float amount, Vector2* out, int count)
+{
+    LerpFloats(&v1->x, &v2->x, amount, &out->x, count * 2);
+}
+
+// Normalize vector array
+RMAPI void Normalize(const Vector2* v, Vector2* out, int count)
+{
+    int i = 0;
+
+#if defined(MATH_SSE2)
+    for (; i + 2 <= count; i += 2)
+    {
+        __m128 xy = _mm_loadu_ps(&v[i].x);
+        __m128 sq = _mm_mul_ps(xy, xy);
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1))));
+        _mm_storeu_ps(&out[i].x, _mm_mul_ps(xy, SafeReciprocal4(length)));
+    }
+#elif defined(MATH_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x2_t xy = vld2q_f32(&v[i].x);
+        float32x4_t length = vsqrtq_f32(vmlaq_f32(vmulq_f32(xy.val[0], xy.val[0]), xy.val[1], xy.val[1]));
+        float32x4_t ilength = vbslq_f32(vcgtq_f32(length, vdupq_n_f32(0.0f)), vdivq_f32(vdupq_n_f32(1.0f), length), vdupq_n_f32(0.0f));
+        xy.val[0] = vmulq_f32(xy.val[0], ilength);
+        xy.val[1] = vmulq_f32(xy.val[1], ilength);
+        vst2q_f32(&out[i].x, xy);
+    }
+#endif
+
+    for (; i < count; i++) out[i] = Normalize(v[i]);
+}
+
+// Rotate vector array by angle
+RMAPI void Rotate(const Vector2* v, float angle, Vector2* out, int count)
+{
+    int i = 0;
+    float cosres = cosf(angle);
+    float sinres = sinf(angle);
+
+#if defined(MATH_SSE2)
+    __m128 c = _mm_set1_ps(cosres);
+    __m128 s = _mm_setr_ps(-sinres, sinres, -sinres, sinres);
+    for (; i + 2 <= count; i += 2)
+    {
+        __m128 xy = _mm_loadu_ps(&v[i].x);
+        __m128 yx = _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(2, 3, 0, 1));
+        _mm_storeu_ps(&out[i].x, _mm_add_ps(_mm_mul_ps(xy, c), _mm_mul_ps(yx, s)));
+    }
+#elif defined(MATH_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x2_t xy = vld2q_f32(&v[i].x);
+        float32x4x2_t result;
+        result.val[0] = vmlsq_n_f32(vmulq_n_f32(xy.val[0], cosres), xy.val[1], sinres);
+        result.val[1] = vmlaq_n_f32(vmulq_n_f32(xy.val[1], cosres), xy.val[0], sinres);
+        vst2q_f32(&out[i].x, result);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        Vector2 p = v[i];
+        out[i].x = p.x * cosres - p.y * sinres;
+        out[i].y = p.x * sinres + p.y * cosres;
+    }
+}
+
+// Calculate distances between two vector arrays (out[i] = Distance(v1[i], v2[i]))
+RMAPI void Distance(const Vector2* v1, const Vector2* v2, float* out, int count)
+{
+    int i = 0;
+
+#if defined(MATH_SSE2)
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 d0 = _mm_sub_ps(_mm_loadu_ps(&v1[i].x), _mm_loadu_ps(&v2[i].x));
+        __m128 d1 = _mm_sub_ps(_mm_loadu_ps(&v1[i + 2].x), _mm_loadu_ps(&v2[i + 2].x));
+        __m128 dx = _mm_shuffle_ps(d0, d1, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 dy = _mm_shuffle_ps(d0, d1, _MM_SHUFFLE(3, 1, 3, 1));
+        _mm_storeu_ps(out + i, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy))));
+    }
+#elif defined(MATH_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x2_t a = vld2q_f32(&v1[i].x);
+        float32x4x2_t b = vld2q_f32(&v2[i].x);
+        float32x4_t dx = vsubq_f32(a.val[0], b.val[0]);
+        float32x4_t dy = vsubq_f32(a.val[1], b.val[1]);
+        vst1q_f32(out + i, vsqrtq_f32(vmlaq_f32(vmulq_f32(dx, dx), dy, dy)));
+    }
+#endif
+
+    for (; i < count; i++) out[i] = Distance(v1[i], v2[i]);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Vector3 batch math
+//----------------------------------------------------------------------------------
+
+// Add two vector arrays (out[i] = v1[i] + v2[i])
+RMAPI void Add(const Vector3* v1, const Vector3* v2, Vector3* out, int count)
+{
+    AddFloats(&v1->x, &v2->x, &out->x, count * 3);
+}
+
+// Subtract two vector arrays (out[i] = v1[i] - v2[i])
+RMAPI void Subtract(const Vector3* v1, const Vector3* v2, Vector3* out, int count)
+{
+    SubtractFloats(&v1->x, &v2->x, &out->x, count * 3);
+}
+
+// Scale vector array (out[i] = v[i] * scale)
+RMAPI void Scale(const Vector3* v, float scale, Vector3* out, int count)
+{
+    ScaleFloats(&v->x, scale, &out->x, count * 3);
+}
+
+// Add scaled vector array, ie integrate positions by velocities (out[i] = v[i] + dir[i] * scale)
+RMAPI void AddScaled(const Vector3* v, const Vector3* dir, float scale, Vector3* out, int count)
+{
+    AddScaledFloats(&v->x, &dir->x, scale, &out->x, count * 3);
+}
+
+// Calculate linear interpolation between two vector arrays
+RMAPI void Lerp(const Vector3* v1, const Vector3* v2, float amount, Vector3* out, int count)
+{
+    LerpFloats(&v1->x, &v2->x, amount, &out->x, count * 3);
+}
+
+// Normalize vector array
+RMAPI void Normalize(const Vector3* v, Vector3* out, int count)
+{
+    int i = 0;
+
+#if defined(MATH_SSE2)
+    for (; i + 4 <= count; i += 4)
+    {
+        const float* src = &v[i].x;
+        __m128 a = _mm_loadu_ps(src);
+        __m128 b = _mm_loadu_ps(src + 4);
+        __m128 c = _mm_loadu_ps(src + 8);
+
+        __m128 x, y, z;
+        Deinterleave3(a, b, c, &x, &y, &z);
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+        __m128 ilength = SafeReciprocal4(length);
+
+        // Spread (l0 l1 l2 l3) over the packed layout (l0 l0 l0 l1 | l1 l1 l2 l2 | l2 l3 l3 l3)
+        float* dst = &out[i].x;
+        _mm_storeu_ps(dst, _mm_mul_ps(a, _mm_shuffle_ps(ilength, ilength, _MM_SHUFFLE(1, 0, 0, 0))));
+        _mm_storeu_ps(dst + 4, _mm_mul_ps(b, _mm_shuffle_ps(ilength, ilength, _MM_SHUFFLE(2, 2, 1, 1))));
+        _mm_storeu_ps(dst + 8, _mm_mul_ps(c, _mm_shuffle_ps(ilength, ilength, _MM_SHUFFLE(3, 3, 3, 2))));
+    }
+#elif defined(MATH_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t xyz = vld3q_f32(&v[i].x);
+        float32x4_t length = vsqrtq_f32(vmlaq_f32(vmlaq_f32(vmulq_f32(xyz.val[0], xyz.val[0]), xyz.val[1], xyz.val[1]), xyz.val[2], xyz.val[2]));
+        float32x4_t ilength = vbslq_f32(vcgtq_f32(length, vdupq_n_f32(0.0f)), vdivq_f32(vdupq_n_f32(1.0f), length), vdupq_n_f32(0.0f));
+        xyz.val[0] = vmulq_f32(xyz.val[0], ilength);
+        xyz.val[1] = vmulq_f32(xyz.val[1], ilength);
+        xyz.val[2] = vmulq_f32(xyz.val[2], ilength);
+        vst3q_f32(&out[i].x, xyz);
+    }
+#endif
+
+    for (; i < count; i++) out[i] = Normalize(v[i]);
+}
+
+// Calculate distances between two vector arrays (out[i] = Distance(v1[i], v2[i]))
+RMAPI void Distance(const Vector3* v1, const Vector3* v2, float* out, int count)
+{
+    int i = 0;
+
+#if defined(MATH_SSE2)
+    for (; i + 4 <= count; i += 4)
+    {
+        const float* p = &v1[i].x;
+        const float* q = &v2[i].x;
+        __m128 a = _mm_sub_ps(_mm_loadu_ps(p), _mm_loadu_ps(q));
+        __m128 b = _mm_sub_ps(_mm_loadu_ps(p + 4), _mm_loadu_ps(q + 4));
+        __m128 c = _mm_sub_ps(_mm_loadu_ps(p + 8), _mm_loadu_ps(q + 8));
+
+        __m128 dx, dy, dz;
+        Deinterleave3(a, b, c, &dx, &dy, &dz);
+        _mm_storeu_ps(out + i, _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz))));
+    }
+#elif defined(MATH_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t a = vld3q_f32(&v1[i].x);
+        float32x4x3_t b = vld3q_f32(&v2[i].x);
+        float32x4_t dx = vsubq_f32(a.val[0], b.val[0]);
+        float32x4_t dy = vsubq_f32(a.val[1], b.val[1]);
+        float32x4_t dz = vsubq_f32(a.val[2], b.val[2]);
+        vst1q_f32(out + i, vsqrtq_f32(vmlaq_f32(vmlaq_f32(vmulq_f32(dx, dx), dy, dy), dz, dz)));
+    }
+#endif
+
+    for (; i < count; i++) out[i] = Distance(v1[i], v2[i]);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Matrix batch math
+//----------------------------------------------------------------------------------
+
+// Multiply every matrix by the same right-hand matrix (out[i] = left[i] * right)
+// NOTE: Use this to bring per-instance local matrices into a shared parent space
+RMAPI void Multiply(const Matrix* left, Matrix right, Matrix* out, int count)
+{
+    for (int i = 0; i < count; i++) out[i] = Multiply(left[i], right);
+}
+
+// Multiply two matrix arrays pairwise (out[i] = left[i] * right[i])
+RMAPI void Multiply(const Matrix* left, const Matrix* right, Matrix* out, int count)
+{
+    for (int i = 0; i < count; i++) out[i] = Multiply(left[i], right[i]);
+}
+
+// Transform a point array by the same matrix (out[i] = Multiply(v[i], mat))
+RMAPI void Multiply(const Vector3* v, Matrix mat, Vector3* out, int count)
+{
+    int i = 0;
+
+#if defined(MATH_SIMD4)
+    float4 m0 = Set4(mat.m0), m4 = Set4(mat.m4), m8 = Set4(mat.m8), m12 = Set4(mat.m12);
+    float4 m1 = Set4(mat.m1), m5 = Set4(mat.m5), m9 = Set4(mat.m9), m13 = Set4(mat.m13);
+    float4 m2 = Set4(mat.m2), m6 = Set4(mat.m6), m10 = Set4(mat.m10), m14 = Set4(mat.m14);
+    for (; i + 4 <= count; i += 4)
+    {
+        float4 x, y, z;
+        Load3x4(v + i, &x, &y, &z);
+        float4 rx = Add4(Add4(Mul4(m0, x), Mul4(m4, y)), Add4(Mul4(m8, z), m12));
+        float4 ry = Add4(Add4(Mul4(m1, x), Mul4(m5, y)), Add4(Mul4(m9, z), m13));
+        float4 rz = Add4(Add4(Mul4(m2, x), Mul4(m6, y)), Add4(Mul4(m10, z), m14));
+        Store3x4(out + i, rx, ry, rz);
+    }
+#endif
+
+    for (; i < count; i++) out[i] = Multiply(v[i], mat);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Batch unprojection
+//----------------------------------------------------------------------------------
+
+// Get the inverted view-projection matrix used to unproject points from screen space
+// NOTE: Compute once per camera and reuse it for every Unproject call of the frame
+RMAPI Matrix UnprojectMatrix(Matrix projection, Matrix view)
+{
+    return Invert(Multiply(view, projection));
+}
+
+// Projects a Vector3 from screen space into object space using a precomputed UnprojectMatrix()
+RMAPI Vector3 Unproject(Vector3 source, Matrix matViewProjInv)
+{
+    Quaternion q = Multiply(Quaternion{ source.x, source.y, source.z, 1.0f }, matViewProjInv);
+    Vector3 result = { q.x / q.w, q.y / q.w, q.z / q.w };
+
+    return result;
+}
+
+// Projects an array of Vector3 from screen space into object space using a precomputed UnprojectMatrix()
+RMAPI void Unproject(const Vector3* source, Matrix matViewProjInv, Vector3* out, int count)
+{
+    int i = 0;
+
+#if defined(MATH_SIMD4)
+    const Matrix& m = matViewProjInv;
+    float4 m0 = Set4(m.m0), m4 = Set4(m.m4), m8 = Set4(m.m8), m12 = Set4(m.m12);
+    float4 m1 = Set4(m.m1), m5 = Set4(m.m5), m9 = Set4(m.m9), m13 = Set4(m.m13);
+    float4 m2 = Set4(m.m2), m6 = Set4(m.m6), m10 = Set4(m.m10), m14 = Set4(m.m14);
+    float4 m3 = Set4(m.m3), m7 = Set4(m.m7), m11 = Set4(m.m11), m15 = Set4(m.m15);
+    for (; i + 4 <= count; i += 4)
+    {
+        float4 x, y, z;
+        Load3x4(source + i, &x, &y, &z);
+        float4 qx = Add4(Add4(Mul4(m0, x), Mul4(m4, y)), Add4(Mul4(m8, z), m12));
+        float4 qy = Add4(Add4(Mul4(m1, x), Mul4(m5, y)), Add4(Mul4(m9, z), m13));
+        float4 qz = Add4(Add4(Mul4(m2, x), Mul4(m6, y)), Add4(Mul4(m10, z), m14));
+        float4 qw = Add4(Add4(Mul4(m3, x), Mul4(m7, y)), Add4(Mul4(m11, z), m15));
+        Store3x4(out + i, Div4(qx, qw), Div4(qy, qw), Div4(qz, qw));
+    }
+#endif
+
+    for (; i < count; i++) out[i] = Unproject(source[i], matViewProjInv);
+}
+
+// Projects an array of Vector3 from screen space into object space
+// NOTE: Same result as calling Unproject(source[i], projection, view) per point, with one matrix inversion in total
+RMAPI void Unproject(const Vector3* source, Matrix projection, Matrix view, Vector3* out, int count)
+{
+    Unproject(source, UnprojectMatrix(projection, view), out, count);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Batch random
+//----------------------------------------------------------------------------------
+
+// Fill a float array with random values between min and max
+RMAPI void Random(Rng* rng, float min, float max, float* out, int count)
+{
+    // Work on a local copy so the state stays in registers
+    Rng local = *rng;
+    for (int i = 0; i < count; i++) out[i] = Random(&local, min, max);
+    *rng = local;
+}
+
+// Fill a vector array with random values, each component between min and max
+RMAPI void Random(Rng* rng, Vector2 min, Vector2 max, Vector2* out, int count)
+{
+    Rng local = *rng;
+    for (int i = 0; i < count; i++)
+    {
+        out[i].x = Random(&local, min.x, max.x);
+        out[i].y = Random(&local, min.y, max.y);
+    }
+    *rng = local;
+}
+
+// Fill a vector array with unit directions whose angles lie between minAngle and maxAngle (radians)
+// NOTE: Use 0 and 2*PI for uniformly distributed directions
+RMAPI void RandomDirections(Rng* rng, float minAngle, float maxAngle, Vector2* out, int count)
+{
+    Rng local = *rng;
+    for (int i = 0; i < count; i++) out[i] = Direction(Random(&local, minAngle, maxAngle));
+    *rng = local;
+}
@@ -0,0 +1,511 @@
+#include "Mesh.h"
+#include "JobSystem.h"
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <thread>
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define OBJ_MAX_FACE_VERTICES 64
+#define OBJ_MIN_CHUNK_SIZE (64*1024)    // Bytes of text per parse job at least
+#define OBJ_CHUNKS_PER_THREAD 2
+
+#define MESH_CACHE_MAGIC 0x4348534Du    // "MSHC"
+#define MESH_CACHE_VERSION 1
+#define MESH_CACHE_ALIGNMENT 64         // Offset alignment of the vertex and index arrays
+
+// Corner index flags: the index was negative and is relative to the parse chunk, see ResolveCorners()
+#define CORNER_LOCAL_POSITION 0x1
+#define CORNER_LOCAL_TEXCOORD 0x2
+#define CORNER_LOCAL_NORMAL 0x4
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Face corner (0-based position, texcoord, normal indices, -1 when missing)
+typedef struct ObjCorner {
+    int index[3];
+    int local;              // CORNER_LOCAL_* flags
+} ObjCorner;
+
+// Text range parsed by one job, and what it found
+typedef struct ObjChunk {
+    const char* begin;
+    const char* end;
+
+    Vector3* positions;
+    Vector3* normals;
+    Vector2* texcoords;
+    int positionCount, normalCount, texcoordCount;
+    int positionCapacity, normalCapacity, texcoordCapacity;
+
+    ObjCorner* corners;
+    int cornerCount, cornerCapacity;
+    int* faceSizes;         // Corners per face
+    int faceCount, faceCapacity;
+
+    int malformedCount;     // v/vn/vt lines with a missing or bad number
+} ObjChunk;
+
+// Binary cache header, followed by the vertex array at vertexOffset and the index array at indexOffset
+typedef struct MeshCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t sourceChecksum;
+    uint64_t sourceSize;
+    uint32_t vertexCount;
+    uint32_t indexCount;
+    uint32_t indexSize;
+    uint32_t vertexOffset;
+    uint32_t indexOffset;
+    Vector3 boundsMin;
+    Vector3 boundsMax;
+} MeshCacheHeader;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition - OBJ parsing
+//----------------------------------------------------------------------------------
+
+// Make room for one more element in a realloc-grown array
+static void* Reserve(void* data, int count, int* capacity, size_t elementSize)
+{
+    if (count < *capacity) return data;
+
+    *capacity = (*capacity == 0)? 1024 : *capacity * 2;
+    return realloc(data, *capacity * elementSize);
+}
+
+static const char* SkipBlanks(const char* p, const char* end)
+{
+    while ((p < end) && ((*p == ' ') || (*p == '\t'))) p++;
+    return p;
+}
+
+// Parse one OBJ index (1-based, or negative relative to the elements read so far) to 0-based
+static int ParseIndex(const char** p, const char* end, int localCount, int localFlag, int* local)
+{
+    long value = 0;
+    std::from_chars_result result = std::from_chars(*p, end, value);
+    if ((result.ec != std::errc()) || (value == 0)) return -1;
+
+    *p = result.ptr;
+    if (value > 0) return (int)(value - 1);
+
+    // Negative: only the count inside this chunk is known here, the chunk offset is added at merge
+    *local |= localFlag;
+    return localCount + (int)value;
+}
+
+// Job: parse the lines of one chunk
+static void ParseObjChunks(void* context, int begin, int end)
+{
+    ObjChunk* chunks = (ObjChunk*)context;
+
+    for (int c = begin; c < end; c++)
+    {
+        ObjChunk* chunk = &chunks[c];
+        const char* p = chunk->begin;
+
+        while (p < chunk->end)
+        {
+            const char* lineEnd = (const char*)memchr(p, '\n', chunk->end - p);
+            if (lineEnd == nullptr) lineEnd = chunk->end;
+
+            p = SkipBlanks(p, lineEnd);
+
+            if ((lineEnd - p > 2) && (p[0] == 'v') && (p[1] == ' '))
+            {
+                chunk->positions = (Vector3*)Reserve(chunk->positions, chunk->positionCount, &chunk->positionCapacity, sizeof(Vector3));
+                Vector3* v = &chunk->positions[chunk->positionCount++];
+                p += 2;
+                *v = Vector3{ 0 };
+                if (!ParseFloat(&p, lineEnd, &v->x) || !ParseFloat(&p, lineEnd, &v->y) || !ParseFloat(&p, lineEnd, &v->z)) chunk->malformedCount++;
+            }
+            else if ((lineEnd - p > 3) && (p[0] == 'v') && (p[1] == 'n') && (p[2] == ' '))
+            {
+                chunk->normals = (Vector3*)Reserve(chunk->normals, chunk->normalCount, &chunk->normalCapacity, sizeof(Vector3));
+                Vector3* n = &chunk->normals[chunk->normalCount++];
+                p += 3;
+                *n = Vector3{ 0 };
+                if (!ParseFloat(&p, lineEnd, &n->x) || !ParseFloat(&p, lineEnd, &n->y) || !ParseFloat(&p, lineEnd, &n->z)) chunk->malformedCount++;
+            }
+            else if ((lineEnd - p > 3) && (p[0] == 'v') && (p[1] == 't') && (p[2] == ' '))
+            {
+                chunk->texcoords = (Vector2*)Reserve(chunk->texcoords, chunk->texcoordCount, &chunk->texcoordCapacity, sizeof(Vector2));
+                Vector2* t = &chunk->texcoords[chunk->texcoordCount++];
+                p += 3;
+                *t = Vector2{ 0 };
+
+                // NOTE: The v coordinate is optional in OBJ (0 when missing)
+                bool valid = ParseFloat(&p, lineEnd, &t->x);
+                const char* rest = SkipBlanks(p, lineEnd);
+                if (valid && (rest < lineEnd) && (*rest != '\r')) valid = ParseFloat(&p, lineEnd, &t->y);
+                if (!valid) chunk->malformedCount++;
+            }
+            else if ((lineEnd - p > 2) && (p[0] == 'f') && (p[1] == ' '))
+            {
+                int cornerCount = 0;
+                p += 2;
+
+                while (cornerCount < OBJ_MAX_FACE_VERTICES)
+                {
+                    p = SkipBlanks(p, lineEnd);
+                    if ((p == lineEnd) || (*p == '\r')) break;
+
+                    chunk->corners = (ObjCorner*)Reserve(chunk->corners, chunk->cornerCount, &chunk->cornerCapacity, sizeof(ObjCorner));
+                    ObjCorner* corner = &chunk->corners[chunk->cornerCount];
+                    corner->local = 0;
+                    corner->index[0] = ParseIndex(&p, lineEnd, chunk->positionCount, CORNER_LOCAL_POSITION, &corner->local);
+                    corner->index[1] = -1;
+                    corner->index[2] = -1;
+
+                    if ((p < lineEnd) && (*p == '/'))
+                    {
+                        p++;
+                        if ((p < lineEnd) && (*p != '/')) corner->index[1] = ParseIndex(&p, lineEnd, chunk->texcoordCount, CORNER_LOCAL_TEXCOORD, &corner->local);
+                        if ((p < lineEnd) && (*p == '/'))
+                        {
+                            p++;
+                            corner->index[2] = ParseIndex(&p, lineEnd, chunk->normalCount, CORNER_LOCAL_NORMAL, &corner->local);
+                        }
+                    }
+
+                    while ((p < lineEnd) && (*p != ' ') && (*p != '\t') && (*p != '\r')) p++;
+
+                    chunk->cornerCount++;
+                    cornerCount++;
+                }
+
+                if (cornerCount >= 3)
+                {
+                    chunk->faceSizes = (int*)Reserve(chunk->faceSizes, chunk->faceCount, &chunk->faceCapacity, sizeof(int));
+                    chunk->faceSizes[chunk->faceCount++] = cornerCount;
+                }
+                else chunk->cornerCount -= cornerCount;
+            }
+
+            p = lineEnd + 1;
+        }
+    }
+}
+
+// Make corner indices global and range checked (-1 when out of range)
+static void ResolveCorners(ObjChunk* chunk, const int offsets[3], const int counts[3])
+{
+    for (int i = 0; i < chunk->cornerCount; i++)
+    {
+        ObjCorner* corner = &chunk->corners[i];
+
+        for (int k = 0; k < 3; k++)
+        {
+            int index = corner->index[k];
+            if (corner->local & (1 << k)) index += offsets[k];
+            corner->index[k] = ((index >= 0) && (index < counts[k]))? index : -1;
+        }
+    }
+}
+
+// Parse OBJ text into deduplicated, indexed mesh data (heap allocated)
+// NOTE: A malformed v/vn/vt line still takes its slot (later faces index by position), with 0 for what couldn't be read
+static MeshData ParseObj(const char* text, size_t size, const char* fileName)
+{
+    MeshData mesh = { 0 };
+
+    // Split on line boundaries, one chunk per job
+    int chunkCount = (GetWorkerCount() + 1) * OBJ_CHUNKS_PER_THREAD;
+    if ((size_t)chunkCount > size / OBJ_MIN_CHUNK_SIZE) chunkCount = (int)(size / OBJ_MIN_CHUNK_SIZE);
+    if (chunkCount < 1) chunkCount = 1;
+
+    ObjChunk* chunks = (ObjChunk*)calloc(chunkCount, sizeof(ObjChunk));
+    const char* end = text + size;
+    const char* start = text;
+
+    for (int c = 0; c < chunkCount; c++)
+    {
+        const char* split = (c == chunkCount - 1)? end : text + size * (c + 1) / chunkCount;
+        if (split < start) split = start;
+        while ((split < end) && (split[-1] != '\n')) split++;
+
+        chunks[c].begin = start;
+        chunks[c].end = split;
+        start = split;
+    }
+
+    JobCounter parsed;
+    ParallelFor(chunkCount, 1, ParseObjChunks, chunks, &parsed);
+    WaitForCounter(&parsed);
+
+    // Concatenate attributes, in file order
+    int offsets[3] = { 0 };
+    int counts[3] = { 0 };
+    int triangleCount = 0;
+    int malformedCount = 0;
+    for (int c = 0; c < chunkCount; c++)
+    {
+        malformedCount += chunks[c].malformedCount;
+        counts[0] += chunks[c].positionCount;
+        counts[1] += chunks[c].texcoordCount;
+        counts[2] += chunks[c].normalCount;
+        for (int f = 0; f < chunks[c].faceCount; f++) triangleCount += chunks[c].faceSizes[f] - 2;
+    }
+
+    if (malformedCount > 0) fprintf(stderr, "WARNING: FILEIO: [%s] OBJ file has %i malformed vertex lines, read as 0\n", fileName, malformedCount);
+
+    Vector3* positions = (Vector3*)malloc((counts[0] + 1) * sizeof(Vector3));
+    Vector2* texcoords = (Vector2*)malloc((counts[1] + 1) * sizeof(Vector2));
+    Vector3* normals = (Vector3*)malloc((counts[2] + 1) * sizeof(Vector3));
+
+    for (int c = 0; c < chunkCount; c++)
+    {
+        ObjChunk* chunk = &chunks[c];
+        if (chunk->positionCount > 0) memcpy(positions + offsets[0], chunk->positions, chunk->positionCount * sizeof(Vector3));
+        if (chunk->texcoordCount > 0) memcpy(texcoords + offsets[1], chunk->texcoords, chunk->texcoordCount * sizeof(Vector2));
+        if (chunk->normalCount > 0) memcpy(normals + offsets[2], chunk->normals, chunk->normalCount * sizeof(Vector3));
+
+        ResolveCorners(chunk, offsets, counts);
+
+        offsets[0] += chunk->positionCount;
+        offsets[1] += chunk->texcoordCount;
+        offsets[2] += chunk->normalCount;
+    }
+
+    // Fan triangulation with corner deduplication (open addressing on the index triple)
+    int indexCount = triangleCount * 3;
+    int tableSize = 16;
+    while (tableSize < indexCount * 2) tableSize *= 2;
+
+    int* table = (int*)malloc(tableSize * sizeof(int));
+    memset(table, 0xFF, tableSize * sizeof(int));
+    ObjCorner* keys = (ObjCorner*)malloc((indexCount + 1) * sizeof(ObjCorner));
+    MeshVertex* vertices = (MeshVertex*)malloc((indexCount + 1) * sizeof(MeshVertex));
+    uint32_t* indices = (uint32_t*)malloc((indexCount + 1) * sizeof(uint32_t));
+    int vertexCount = 0;
+    int written = 0;
+
+    for (int c = 0; c < chunkCount; c++)
+    {
+        const ObjCorner* corners = chunks[c].corners;
+
+        for (int f = 0; f < chunks[c].faceCount; f++)
+        {
+            int faceSize = chunks[c].faceSizes[f];
+
+            for (int i = 1; i + 1 < faceSize; i++)
+            {
+                const ObjCorner* triangle[3] = { &corners[0], &corners[i], &corners[i + 1] };
+
+                for (int k = 0; k < 3; k++)
+                {
+                    const int* key = triangle[k]->index;
+                    uint32_t hash = ((uint32_t)key[0] * 73856093u) ^ ((uint32_t)key[1] * 19349663u) ^ ((uint32_t)key[2] * 83492791u);
+                    uint32_t slot = hash & (tableSize - 1);
+
+                    while ((table[slot] >= 0) && (memcmp(keys[table[slot]].index, key, sizeof(int) * 3) != 0)) slot = (slot + 1) & (tableSize - 1);
+
+                    if (table[slot] < 0)
+                    {
+                        MeshVertex* vertex = &vertices[vertexCount];
+                        vertex->position = (key[0] >= 0)? positions[key[0]] : Vector3Zero();
+                        vertex->texcoord = (key[1] >= 0)? texcoords[key[1]] : Vector2Zero();
+                        vertex->normal = (key[2] >= 0)? normals[key[2]] : Vector3Zero();
+
+                        keys[vertexCount] = *triangle[k];
+                        table[slot] = vertexCount++;
+                    }
+
+                    indices[written++] = (uint32_t)table[slot];
+                }
+            }
+
+            corners += faceSize;
+        }
+    }
+
+    for (int c = 0; c < chunkCount; c++)
+    {
+        free(chunks[c].positions);
+        free(chunks[c].normals);
+        free(chunks[c].texcoords);
+        free(chunks[c].corners);
+        free(chunks[c].faceSizes);
+    }
+
+    free(chunks);
+    free(table);
+    free(keys);
+    free(positions);
+    free(texcoords);
+    free(normals);
+
+    // Narrow the indices when they fit
+    mesh.indexSize = (vertexCount <= UINT16_MAX + 1)? 2 : 4;
+    if (mesh.indexSize == 2)
+    {
+        uint16_t* narrow = (uint16_t*)malloc((indexCount + 1) * sizeof(uint16_t));
+        for (int i = 0; i < indexCount; i++) narrow[i] = (uint16_t)indices[i];
+        free(indices);
+        mesh.indices = narrow;
+    }
+    else mesh.indices = indices;
+
+    mesh.vertices = (MeshVertex*)realloc(vertices, (vertexCount + 1) * sizeof(MeshVertex));
+    mesh.vertexCount = vertexCount;
+    mesh.indexCount = indexCount;
+
+    for (int i = 0; i < vertexCount; i++)
+    {
+        mesh.boundsMin = (i == 0)? mesh.vertices[i].position : Min(mesh.boundsMin, mesh.vertices[i].position);
+        mesh.boundsMax = (i == 0)? mesh.vertices[i].position : Max(mesh.boundsMax, mesh.vertices[i].position);
+    }
+
+    return mesh;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition - Binary cache
+//----------------------------------------------------------------------------------
+
+static uint32_t AlignOffset(size_t offset)
+{
+    return (uint32_t)((offset + MESH_CACHE_ALIGNMENT - 1) & ~(size_t)(MESH_CACHE_ALIGNMENT - 1));
+}
+
+// Map a cache file, returns false if it is missing, malformed or (with a source) built from other contents
+static bool LoadMeshCache(const char* cacheName, const MappedFile* source, uint64_t sourceChecksum, MeshData* mesh)
+{
+    MappedFile cache = LoadMappedFile(cacheName);
+    if (cache.data == nullptr) return false;
+
+    MeshCacheHeader header;
+    bool valid = (cache.size >= sizeof(MeshCacheHeader));
+    if (valid)
+    {
+        memcpy(&header, cache.data, sizeof(MeshCacheHeader));
+        valid = (header.magic == MESH_CACHE_MAGIC) && (header.version == MESH_CACHE_VERSION) && ((header.indexSize == 2) || (header.indexSize == 4)) &&
+            ((size_t)header.vertexOffset + (size_t)header.vertexCount * sizeof(MeshVertex) <= cache.size) &&
+            ((size_t)header.indexOffset + (size_t)header.indexCount * header.indexSize <= cache.size);
+    }
+
+    if (valid && (source->data != nullptr)) valid = (header.sourceSize == source->size) && (header.sourceChecksum == sourceChecksum);
+
+    if (!valid)
+    {
+        UnloadMappedFile(cache);
+        return false;
+    }
+
+    mesh->vertices = (const MeshVertex*)(cache.data + header.vertexOffset);
+    mesh->indices = cache.data + header.indexOffset;
+    mesh->vertexCount = (int)header.vertexCount;
+    mesh->indexCount = (int)header.indexCount;
+    mesh->indexSize = (int)header.indexSize;
+    mesh->boundsMin = header.boundsMin;
+    mesh->boundsMax = header.boundsMax;
+    mesh->cache = cache;
+
+    return true;
+}
+
+// NOTE: The cache is written to a temporary file then renamed over the old one, so threads loading the same mesh
+// (e.g. asset streamer requests) never map a half written or truncated cache
+static void SaveMeshCache(const char* cacheName, const MeshData* mesh, const MappedFile* source, uint64_t sourceChecksum)
+{
+    char tempName[1100];
+    snprintf(tempName, sizeof(tempName), "%s.%zx.tmp", cacheName, std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+    FILE* file = fopen(tempName, "wb");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "WARNING: FILEIO: [%s] Failed to write mesh cache\n", cacheName);
+        return;
+    }
+
+    MeshCacheHeader header = { 0 };
+    header.magic = MESH_CACHE_MAGIC;
+    header.version = MESH_CACHE_VERSION;
+    header.sourceChecksum = sourceChecksum;
+    header.sourceSize = source->size;
+    header.vertexCount = (uint32_t)mesh->vertexCount;
+    header.indexCount = (uint32_t)mesh->indexCount;
+    header.indexSize = (uint32_t)mesh->indexSize;
+    header.vertexOffset = AlignOffset(sizeof(MeshCacheHeader));
+    header.indexOffset = AlignOffset(header.vertexOffset + mesh->vertexCount * sizeof(MeshVertex));
+    header.boundsMin = mesh->boundsMin;
+    header.boundsMax = mesh->boundsMax;
+
+    static const unsigned char padding[MESH_CACHE_ALIGNMENT] = { 0 };
+    size_t vertexBytes = mesh->vertexCount * sizeof(MeshVertex);
+
+    bool ok = (fwrite(&header, sizeof(header), 1, file) == 1);
+    ok = ok && (fwrite(padding, 1, header.vertexOffset - sizeof(header), file) == header.vertexOffset - sizeof(header));
+    ok = ok && (fwrite(mesh->vertices, 1, vertexBytes, file) == vertexBytes);
+    ok = ok && (fwrite(padding, 1, header.indexOffset - header.vertexOffset - vertexBytes, file) == header.indexOffset - header.vertexOffset - vertexBytes);
+    ok = ok && (fwrite(mesh->indices, mesh->indexSize, mesh->indexCount, file) == (size_t)mesh->indexCount);
+    ok = (fclose(file) == 0) && ok;
+
+#if defined(_WIN32)
+    if (ok) remove(cacheName);      // rename doesn't replace files on Windows
+#endif
+    ok = ok && (rename(tempName, cacheName) == 0);
+
+    if (!ok)
+    {
+        fprintf(stderr, "WARNING: FILEIO: [%s] Failed to write mesh cache\n", cacheName);
+        remove(tempName);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+MeshData LoadMeshData(const char* fileName)
+{
+    MeshData mesh = { 0 };
+
+    char cacheName[1024];
+    snprintf(cacheName, sizeof(cacheName), "%s%s", fileName, MESH_CACHE_EXTENSION);
+
+    MappedFile source = LoadMappedFile(fileName);
+    uint64_t checksum = (source.data != nullptr)? Checksum64(source.data, source.size) : 0;
+
+    if (LoadMeshCache(cacheName, &source, checksum, &mesh))
+    {
+        UnloadMappedFile(source);
+        return mesh;
+    }
+
+    if (source.data == nullptr)
+    {
+        fprintf(stderr, "WARNING: FILEIO: [%s] Failed to open mesh file\n", fileName);
+        return mesh;
+    }
+
+    mesh = ParseObj((const char*)source.data, source.size, fileName);
+    SaveMeshCache(cacheName, &mesh, &source, checksum);
+    UnloadMappedFile(source);
+
+    return mesh;
+}
+
+MeshData LoadMeshDataFromMemory(const char* text, size_t size)
+{
+    return ParseObj(text, size, "memory");
+}
+
+void UnloadMeshData(MeshData mesh)
+{
+    if (mesh.cache.data != nullptr)
+    {
+        UnloadMappedFile(mesh.cache);
+        return;
+    }
+
+    free((void*)mesh.vertices);
+    free((void*)mesh.indices);
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "Math.h"
+#include "MappedFile.h"
+
+// Raylib-free mesh data loaded from Wavefront OBJ files, usable by headless tools.
+// Faces are triangulated as fans, identical corners (same position, texcoord and normal) share one
+// interleaved vertex, indices are 16-bit when the vertex count allows it.
+// The first load of an OBJ writes a binary cache next to it (MESH_CACHE_EXTENSION), later loads map that cache
+// and point straight into it as long as its stored checksum matches the OBJ contents.
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MESH_CACHE_EXTENSION ".meshcache"
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Interleaved mesh vertex type
+typedef struct MeshVertex {
+    Vector3 position;
+    Vector3 normal;         // Zero when the file has no normals
+    Vector2 texcoord;       // Zero when the file has no texture coordinates
+} MeshVertex;
+
+// Mesh data type
+typedef struct MeshData {
+    const MeshVertex* vertices;
+    const void* indices;    // Triangle list, uint16_t or uint32_t depending on indexSize
+    int vertexCount;
+    int indexCount;
+    int indexSize;          // Bytes per index, 2 or 4
+    Vector3 boundsMin;
+    Vector3 boundsMax;
+    MappedFile cache;       // Backing cache mapping, data is NULL when the arrays are heap allocated
+} MeshData;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+// Load mesh data from an OBJ file through its binary cache, (re)building the cache when missing or stale
+// NOTE: Without the OBJ file, a cache next to where it would be is used as is
+MeshData LoadMeshData(const char* fileName);
+
+// Parse mesh data from OBJ text in memory (no cache)
+MeshData LoadMeshDataFromMemory(const char* text, size_t size);
+
+// Free mesh data
+void UnloadMeshData(MeshData mesh);
+
+// Get vertex index i of the triangle list
+inline int GetMeshIndex(const MeshData* mesh, int i)
+{
+    return (mesh->indexSize == 2)? ((const uint16_t*)mesh->indices)[i] : (int)((const uint32_t*)mesh->indices)[i];
+}
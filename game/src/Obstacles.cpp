@@ -0,0 +1,246 @@
+#include "Obstacles.h"
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define OBSTACLES_MAGIC 0x5453424Fu     // "OBST"
+#define OBSTACLES_VERSION 1
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Arrays of a binary level, in file order
+typedef enum {
+    OBSTACLES_ARRAY_X = 0,
+    OBSTACLES_ARRAY_Y,
+    OBSTACLES_ARRAY_W,
+    OBSTACLES_ARRAY_H,
+    OBSTACLES_ARRAY_TAGS,               // Optional
+    OBSTACLES_ARRAY_COUNT
+} ObstaclesArray;
+
+// Binary level header, each array is count 32-bit values at its offset (0 for an absent optional array)
+typedef struct ObstaclesHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+    uint32_t reserved;
+    Aabb bounds;
+    uint64_t offsets[OBSTACLES_ARRAY_COUNT];
+} ObstaclesHeader;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+static const char* SkipBlanks(const char* p, const char* end)
+{
+    while ((p < end) && ((*p == ' ') || (*p == '\t') || (*p == '\r'))) p++;
+    return p;
+}
+
+// Use a mapped binary level in place, false when the header or array ranges don't check out
+static bool MapObstacles(MappedFile file, Obstacles* obstacles)
+{
+    ObstaclesHeader header = { 0 };
+    if (file.size < sizeof(ObstaclesHeader)) return false;
+    memcpy(&header, file.data, sizeof(ObstaclesHeader));
+
+    if ((header.version != OBSTACLES_VERSION) || (header.count > INT32_MAX)) return false;
+
+    const void* arrays[OBSTACLES_ARRAY_COUNT] = { 0 };
+    for (int i = 0; i < OBSTACLES_ARRAY_COUNT; i++)
+    {
+        uint64_t offset = header.offsets[i];
+        if ((offset == 0) && (i == OBSTACLES_ARRAY_TAGS)) continue;
+
+        if ((offset < sizeof(ObstaclesHeader)) || (offset % OBSTACLES_ALIGNMENT != 0) || (offset > file.size) ||
+            ((file.size - offset)/sizeof(float) < header.count)) return false;
+
+        arrays[i] = file.data + offset;
+    }
+
+    obstacles->x = (const float*)arrays[OBSTACLES_ARRAY_X];
+    obstacles->y = (const float*)arrays[OBSTACLES_ARRAY_Y];
+    obstacles->w = (const float*)arrays[OBSTACLES_ARRAY_W];
+    obstacles->h = (const float*)arrays[OBSTACLES_ARRAY_H];
+    obstacles->tags = (const uint32_t*)arrays[OBSTACLES_ARRAY_TAGS];
+    obstacles->count = (int)header.count;
+    obstacles->bounds = header.bounds;
+    obstacles->file = file;
+
+    return true;
+}
+
+static uint64_t AlignObstaclesOffset(uint64_t offset)
+{
+    return (offset + OBSTACLES_ALIGNMENT - 1) & ~(uint64_t)(OBSTACLES_ALIGNMENT - 1);
+}
+
+// Parse level text into heap arrays
+static Obstacles ParseObstacles(const char* text, size_t size, const char* fileName)
+{
+    Obstacles obstacles = { 0 };
+    const char* end = text + size;
+
+    // One allocation sized by the line count holds every array, tags are dropped again if no line has one
+    size_t lines = 1;
+    for (const char* p = text; (p = (const char*)memchr(p, '\n', end - p)) != nullptr; p++) lines++;
+
+    float* data = (float*)malloc(lines * 4 * sizeof(float) + lines * sizeof(uint32_t));
+    float* x = data;
+    float* y = x + lines;
+    float* w = y + lines;
+    float* h = w + lines;
+    uint32_t* tags = (uint32_t*)(h + lines);
+    bool tagged = false;
+    int count = 0;
+
+    for (const char* line = text; line < end; )
+    {
+        const char* lineEnd = (const char*)memchr(line, '\n', end - line);
+        if (lineEnd == nullptr) lineEnd = end;
+
+        const char* p = line;
+        line = lineEnd + 1;
+        if (SkipBlanks(p, lineEnd) == lineEnd) continue;
+
+        float values[4];
+        bool valid = ParseFloat(&p, lineEnd, &values[0]) && ParseFloat(&p, lineEnd, &values[1]) &&
+            ParseFloat(&p, lineEnd, &values[2]) && ParseFloat(&p, lineEnd, &values[3]);
+
+        uint32_t tag = 0;
+        p = SkipBlanks(p, lineEnd);
+        if (valid && (p < lineEnd))
+        {
+            std::from_chars_result result = std::from_chars(p, lineEnd, tag);
+            valid = (result.ec == std::errc()) && (SkipBlanks(result.ptr, lineEnd) == lineEnd);
+            tagged = true;
+        }
+
+        if (!valid)
+        {
+            fprintf(stderr, "WARNING: FILEIO: [%s] Obstacles file has a malformed line after %i entries\n", fileName, count);
+            break;
+        }
+
+        x[count] = values[0];
+        y[count] = values[1];
+        w[count] = values[2];
+        h[count] = values[3];
+        tags[count] = tag;
+
+        Aabb box = ToAabb(values[0], values[1], values[2], values[3]);
+        obstacles.bounds = (count == 0)? box : Merge(obstacles.bounds, box);
+        count++;
+    }
+
+    obstacles.x = x;
+    obstacles.y = y;
+    obstacles.w = w;
+    obstacles.h = h;
+    obstacles.tags = tagged? tags : nullptr;
+    obstacles.count = count;
+
+    return obstacles;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+Obstacles LoadObstacles(const char* fileName)
+{
+    Obstacles obstacles = { 0 };
+
+    MappedFile file = LoadMappedFile(fileName);
+    if (file.data == nullptr)
+    {
+        fprintf(stderr, "WARNING: FILEIO: [%s] Failed to open obstacles file\n", fileName);
+        return obstacles;
+    }
+
+    uint32_t magic = 0;
+    if (file.size >= sizeof(magic)) memcpy(&magic, file.data, sizeof(magic));
+
+    if (magic == OBSTACLES_MAGIC)
+    {
+        // NOTE: The mapping stays alive as the storage of the arrays, UnloadObstacles releases it
+        if (!MapObstacles(file, &obstacles))
+        {
+            fprintf(stderr, "WARNING: FILEIO: [%s] Invalid binary obstacles file\n", fileName);
+            UnloadMappedFile(file);
+        }
+
+        return obstacles;
+    }
+
+    obstacles = ParseObstacles((const char*)file.data, file.size, fileName);
+    UnloadMappedFile(file);
+
+    return obstacles;
+}
+
+void UnloadObstacles(Obstacles obstacles)
+{
+    // Text levels own one block starting at x, binary levels own the mapping
+    if (obstacles.file.data != nullptr) UnloadMappedFile(obstacles.file);
+    else free((void*)obstacles.x);
+}
+
+bool ExportObstacles(const Obstacles* obstacles, const char* fileName)
+{
+    FILE* file = fopen(fileName, "wb");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "WARNING: FILEIO: [%s] Failed to create obstacles file\n", fileName);
+        return false;
+    }
+
+    const void* arrays[OBSTACLES_ARRAY_COUNT] = { obstacles->x, obstacles->y, obstacles->w, obstacles->h, obstacles->tags };
+    size_t arraySize = (size_t)obstacles->count * sizeof(float);
+
+    ObstaclesHeader header = { 0 };
+    header.magic = OBSTACLES_MAGIC;
+    header.version = OBSTACLES_VERSION;
+    header.count = (uint32_t)obstacles->count;
+    header.bounds = obstacles->bounds;
+
+    uint64_t offset = sizeof(ObstaclesHeader);
+    for (int i = 0; i < OBSTACLES_ARRAY_COUNT; i++)
+    {
+        if (arrays[i] == nullptr) continue;
+
+        header.offsets[i] = AlignObstaclesOffset(offset);
+        offset = header.offsets[i] + arraySize;
+    }
+
+    static const unsigned char padding[OBSTACLES_ALIGNMENT] = { 0 };
+    bool ok = (fwrite(&header, sizeof(header), 1, file) == 1);
+    offset = sizeof(ObstaclesHeader);
+
+    for (int i = 0; ok && (i < OBSTACLES_ARRAY_COUNT); i++)
+    {
+        if (arrays[i] == nullptr) continue;
+
+        size_t paddingSize = (size_t)(header.offsets[i] - offset);
+        ok = (fwrite(padding, 1, paddingSize, file) == paddingSize);
+        ok = ok && (fwrite(arrays[i], 1, arraySize, file) == arraySize);
+        offset = header.offsets[i] + arraySize;
+    }
+
+    ok = (fclose(file) == 0) && ok;
+
+    if (!ok)
+    {
+        fprintf(stderr, "WARNING: FILEIO: [%s] Failed to write obstacles file\n", fileName);
+        remove(fileName);
+    }
+
+    return ok;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "Math.h"
+#include "MappedFile.h"
+
+// Static level obstacles: axis-aligned rectangles stored as structure-of-arrays.
+// Text format is one rectangle per line, "x y w h [tag]" with (x, y) the top-left corner and an optional integer tag.
+// Binary format (see ExportObstacles) stores the same arrays, each on an OBSTACLES_ALIGNMENT boundary, after a
+// versioned header holding the count, the level bounds and which optional arrays are present. Binary levels are
+// memory-mapped and the arrays used in place, so loading costs one header check regardless of the level size.
+// LoadObstacles tells the formats apart by the binary magic number, the file extension doesn't matter.
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define OBSTACLES_ALIGNMENT 64          // Byte alignment of every array in a binary level
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Obstacle set type
+typedef struct Obstacles {
+    const float* x;
+    const float* y;
+    const float* w;
+    const float* h;
+    const uint32_t* tags;       // Per obstacle tag (e.g. material or trigger id), NULL when the level has none
+    int count;
+    Aabb bounds;                // Union of all obstacles, zero when empty
+    MappedFile file;            // Backing binary level mapping, data is NULL when the arrays are heap allocated
+} Obstacles;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+// Load obstacles from a text or binary level file (empty set when the file can't be read)
+Obstacles LoadObstacles(const char* fileName);
+
+// Free obstacle data
+void UnloadObstacles(Obstacles obstacles);
+
+// Write obstacles as a binary level file, returns false on failure
+bool ExportObstacles(const Obstacles* obstacles, const char* fileName);
+
+// Get the bounds of obstacle i
+inline Aabb GetObstacleBounds(const Obstacles* obstacles, int i)
+{
+    return ToAabb(obstacles->x[i], obstacles->y[i], obstacles->w[i], obstacles->h[i]);
+}
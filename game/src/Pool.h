@@ -0,0 +1,161 @@
+#pragma once
+#include "Math.h"
+#include <type_traits>
+
+// Fixed-capacity object pool with stable handles.
+// Live objects are dense: position, velocity and the per-object payload T sit in parallel arrays indexed
+// [0, count), so update loops and the Math.h batch kernels walk contiguous memory with no holes to skip.
+// Handles point at a sparse slot that tracks where its object currently lives in the dense arrays and a
+// generation counter, releasing an object moves the last one into its place and bumps the slot generation,
+// so handles to released objects are detected instead of silently aliasing a newer object.
+// Memory is allocated once by LoadPool, spawning and releasing never touch the heap.
+// T must be trivially copyable: objects are moved with plain copies and never constructed or destroyed.
+// NOTE: Not thread-safe, give each system its own pool or acquire/release from one thread
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define POOL_NULL_SLOT 0xFFFFFFFFu
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Pool handle type, generation 0 is never handed out
+typedef struct PoolHandle {
+    uint32_t slot;
+    uint32_t generation;
+} PoolHandle;
+
+// Sparse slot type: dense index of a live object, or the next free slot
+typedef struct PoolSlot {
+    uint32_t dense;
+    uint32_t generation;
+} PoolSlot;
+
+// Pool type
+template <typename T>
+struct Pool {
+    static_assert(std::is_trivially_copyable_v<T>, "Pool items are copied as raw memory");
+
+    Vector2* positions;         // Dense arrays, [0, count) are live
+    Vector2* velocities;
+    T* items;
+    uint32_t* owners;           // Slot of each dense object
+    PoolSlot* slots;
+    uint32_t freeSlot;          // Head of the free slot list
+    int count;
+    int capacity;
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Create a pool with room for capacity objects
+template <typename T>
+Pool<T> LoadPool(int capacity)
+{
+    Pool<T> pool = { 0 };
+    pool.freeSlot = POOL_NULL_SLOT;
+    if (capacity <= 0) return pool;
+
+    pool.positions = (Vector2*)malloc(capacity * sizeof(Vector2));
+    pool.velocities = (Vector2*)malloc(capacity * sizeof(Vector2));
+    pool.items = (T*)malloc(capacity * sizeof(T));
+    pool.owners = (uint32_t*)malloc(capacity * sizeof(uint32_t));
+    pool.slots = (PoolSlot*)malloc(capacity * sizeof(PoolSlot));
+    pool.capacity = capacity;
+
+    for (int i = 0; i < capacity; i++) pool.slots[i] = PoolSlot{ (i + 1 < capacity)? (uint32_t)(i + 1) : POOL_NULL_SLOT, 1 };
+    pool.freeSlot = 0;
+
+    return pool;
+}
+
+// Free pool memory
+template <typename T>
+void UnloadPool(Pool<T> pool)
+{
+    free(pool.positions);
+    free(pool.velocities);
+    free(pool.items);
+    free(pool.owners);
+    free(pool.slots);
+}
+
+// Add an object, returns a null handle (generation 0) when the pool is full
+template <typename T>
+PoolHandle AcquirePoolItem(Pool<T>* pool, Vector2 position, Vector2 velocity, const T& item)
+{
+    PoolHandle handle = { POOL_NULL_SLOT, 0 };
+    if (pool->freeSlot == POOL_NULL_SLOT) return handle;
+
+    uint32_t slot = pool->freeSlot;
+    uint32_t dense = (uint32_t)pool->count++;
+
+    pool->freeSlot = pool->slots[slot].dense;
+    pool->slots[slot].dense = dense;
+
+    pool->positions[dense] = position;
+    pool->velocities[dense] = velocity;
+    pool->items[dense] = item;
+    pool->owners[dense] = slot;
+
+    handle.slot = slot;
+    handle.generation = pool->slots[slot].generation;
+
+    return handle;
+}
+
+// Remove the object at dense index, the last object takes its place
+// NOTE: When releasing while iterating, walk backwards so the moved object has already been visited
+template <typename T>
+void ReleasePoolItemAt(Pool<T>* pool, int index)
+{
+    uint32_t slot = pool->owners[index];
+    int last = --pool->count;
+
+    if (index != last)
+    {
+        pool->positions[index] = pool->positions[last];
+        pool->velocities[index] = pool->velocities[last];
+        pool->items[index] = pool->items[last];
+        pool->owners[index] = pool->owners[last];
+        pool->slots[pool->owners[index]].dense = (uint32_t)index;
+    }
+
+    // Skip generation 0 on wrap around, it marks null handles
+    PoolSlot* freed = &pool->slots[slot];
+    freed->generation = (freed->generation == UINT32_MAX)? 1 : freed->generation + 1;
+    freed->dense = pool->freeSlot;
+    pool->freeSlot = slot;
+}
+
+// Get the dense index of a live object, -1 if the handle is stale or null
+template <typename T>
+int GetPoolIndex(const Pool<T>* pool, PoolHandle handle)
+{
+    if ((handle.slot >= (uint32_t)pool->capacity) || (pool->slots[handle.slot].generation != handle.generation)) return -1;
+
+    return (int)pool->slots[handle.slot].dense;
+}
+
+// Remove the object a handle refers to, returns false if the handle is stale
+template <typename T>
+bool ReleasePoolItem(Pool<T>* pool, PoolHandle handle)
+{
+    int index = GetPoolIndex(pool, handle);
+    if (index < 0) return false;
+
+    ReleasePoolItemAt(pool, index);
+
+    return true;
+}
+
+// Remove every object, outstanding handles become stale
+template <typename T>
+void ClearPool(Pool<T>* pool)
+{
+    while (pool->count > 0) ReleasePoolItemAt(pool, pool->count - 1);
+}
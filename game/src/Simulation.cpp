@@ -0,0 +1,186 @@
+#include "Simulation.h"
+#include "JobSystem.h"
+#include <cstdlib>
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define PLAYER_MAX_CONTACTS 16
+#define PLAYER_SPAWN_ATTEMPTS 64
+#define BULLET_BATCH_SIZE 256       // Bullets swept per job
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Push the player out of every obstacle it overlaps and cancel the velocity into them
+static void ResolvePlayer(Simulation* sim)
+{
+    int ids[PLAYER_MAX_CONTACTS];
+    int count = QueryCircle(&sim->grid, sim->playerPosition, PLAYER_RADIUS, ids, PLAYER_MAX_CONTACTS);
+
+    for (int i = 0; i < count; i++)
+    {
+        Contact contact;
+        if (!Collide(Circle{ sim->playerPosition, PLAYER_RADIUS }, GetObstacleBounds(&sim->obstacles, ids[i]), &contact)) continue;
+
+        sim->playerPosition = Subtract(sim->playerPosition, Scale(contact.normal, contact.depth));
+
+        float into = Dot(sim->playerVelocity, contact.normal);
+        if (into > 0.0f) sim->playerVelocity = Subtract(sim->playerVelocity, Scale(contact.normal, into));
+    }
+
+    sim->playerPosition = Clamp(sim->playerPosition, Add(sim->world.min, PLAYER_RADIUS), Subtract(sim->world.max, PLAYER_RADIUS));
+}
+
+// Check if the player would overlap an obstacle at position
+static bool Blocked(const Simulation* sim, Vector2 position)
+{
+    int id;
+    return QueryCircle(&sim->grid, position, PLAYER_RADIUS, &id, 1) > 0;
+}
+
+// Job: sweep bullets [begin, end) along their motion for this step
+static void SweepBullets(void* context, int begin, int end)
+{
+    Simulation* sim = (Simulation*)context;
+
+    Sweep(&sim->grid, &sim->obstacles, sim->bullets.positions + begin, sim->bulletMotions + begin, BULLET_RADIUS, end - begin,
+        sim->bulletImpacts + begin, sim->bulletHitIds + begin);
+}
+
+static void SpawnBullet(Simulation* sim)
+{
+    Vector2 muzzle = Add(sim->playerPosition, Scale(sim->playerHeading, PLAYER_RADIUS));
+    Vector2 velocity = Add(Scale(sim->playerHeading, BULLET_SPEED), sim->playerVelocity);
+
+    // NOTE: A full pool drops the shot
+    PoolHandle bullet = AcquirePoolItem(&sim->bullets, muzzle, velocity, Bullet{ muzzle, BULLET_LIFETIME });
+    if (bullet.generation != 0) sim->shotsFired++;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Fixed timestep clock
+//----------------------------------------------------------------------------------
+
+FixedClock LoadFixedClock(int tickRate)
+{
+    FixedClock clock = { 0 };
+    clock.step = 1.0f / (float)tickRate;
+
+    return clock;
+}
+
+int AdvanceClock(FixedClock* clock, double frameTime)
+{
+    clock->accumulator += frameTime;
+
+    int steps = (int)(clock->accumulator / clock->step);
+
+    // Drop time we can't catch up on (breakpoints, window drags) instead of spiralling
+    if (steps > SIM_MAX_STEPS_PER_FRAME)
+    {
+        steps = SIM_MAX_STEPS_PER_FRAME;
+        clock->accumulator = steps * (double)clock->step;
+    }
+
+    clock->accumulator -= steps * (double)clock->step;
+
+    return steps;
+}
+
+float GetClockAlpha(const FixedClock* clock)
+{
+    return (float)(clock->accumulator / clock->step);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Simulation
+//----------------------------------------------------------------------------------
+
+Simulation LoadSimulation(const char* obstaclesFileName, uint64_t seed)
+{
+    Simulation sim = { 0 };
+
+    sim.obstacles = LoadObstacles(obstaclesFileName);
+    sim.grid = LoadGrid(&sim.obstacles, 0.0f);
+    sim.rng = SeedRng(seed);
+
+    sim.world = ToAabb(0.0f, 0.0f, SIM_WORLD_WIDTH, SIM_WORLD_HEIGHT);
+    if (sim.obstacles.count > 0) sim.world = Merge(sim.world, sim.obstacles.bounds);
+
+    sim.bullets = LoadPool<Bullet>(SIM_MAX_BULLETS);
+    sim.bulletMotions = (Vector2*)malloc(SIM_MAX_BULLETS * sizeof(Vector2));
+    sim.bulletImpacts = (Impact*)malloc(SIM_MAX_BULLETS * sizeof(Impact));
+    sim.bulletHitIds = (int*)malloc(SIM_MAX_BULLETS * sizeof(int));
+
+    // Spawn at the center of the world, or the first free random spot
+    Vector2 spawn = Scale(Add(sim.world.min, sim.world.max), 0.5f);
+    for (int i = 0; (i < PLAYER_SPAWN_ATTEMPTS) && Blocked(&sim, spawn); i++)
+    {
+        spawn = Vector2{ Random(&sim.rng, sim.world.min.x, sim.world.max.x), Random(&sim.rng, sim.world.min.y, sim.world.max.y) };
+    }
+
+    sim.playerPosition = spawn;
+    sim.playerPrevious = spawn;
+    sim.playerHeading = Vector2{ 1.0f, 0.0f };
+
+    return sim;
+}
+
+void UnloadSimulation(Simulation sim)
+{
+    UnloadGrid(sim.grid);
+    UnloadObstacles(sim.obstacles);
+
+    UnloadPool(sim.bullets);
+    free(sim.bulletMotions);
+    free(sim.bulletImpacts);
+    free(sim.bulletHitIds);
+}
+
+void StepSimulation(Simulation* sim, SimInput input, float dt)
+{
+    // Player
+    sim->playerPrevious = sim->playerPosition;
+    sim->playerVelocity = Add(sim->playerVelocity, Scale(input.move, PLAYER_ACCELERATION * dt));
+    sim->playerVelocity = Scale(sim->playerVelocity, fmaxf(0.0f, 1.0f - PLAYER_DAMPING * dt));
+    sim->playerPosition = Add(sim->playerPosition, Scale(sim->playerVelocity, dt));
+    ResolvePlayer(sim);
+
+    if (LengthSqr(input.aim) > EPSILON) sim->playerHeading = Normalize(input.aim);
+
+    sim->fireCooldown -= dt;
+    if (input.fire && (sim->fireCooldown <= 0.0f))
+    {
+        SpawnBullet(sim);
+        sim->fireCooldown = FIRE_INTERVAL;
+    }
+
+    // Bullets: sweep the whole step so fast bullets can't skip thin obstacles, then integrate
+    Pool<Bullet>* bullets = &sim->bullets;
+    int count = bullets->count;
+    for (int i = 0; i < count; i++) bullets->items[i].previous = bullets->positions[i];
+    Scale(bullets->velocities, dt, sim->bulletMotions, count);
+
+    JobCounter sweeps;
+    ParallelFor(count, BULLET_BATCH_SIZE, SweepBullets, sim, &sweeps);
+    WaitForCounter(&sweeps);
+
+    AddScaled(bullets->positions, bullets->velocities, dt, bullets->positions, count);
+
+    // Walk backwards so the bullet swapped into slot i has already been processed
+    for (int i = count - 1; i >= 0; i--)
+    {
+        bullets->items[i].life -= dt;
+
+        if (sim->bulletHitIds[i] >= 0)
+        {
+            sim->hits++;
+            ReleasePoolItemAt(bullets, i);
+        }
+        else if ((bullets->items[i].life <= 0.0f) || !Contains(sim->world, bullets->positions[i])) ReleasePoolItemAt(bullets, i);
+    }
+
+    sim->tick++;
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include "Collision.h"
+#include "Pool.h"
+
+// Game simulation, stepped at a fixed rate independently of rendering.
+// Nothing here touches raylib, so the simulation runs the same with or without a window.
+// Every step saves the previous state next to the current one, renderers blend the two
+// with the FixedClock alpha to draw smooth motion at any frame rate.
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define SIM_TICK_RATE 120               // Simulation steps per second
+#define SIM_MAX_STEPS_PER_FRAME 8       // Steps run per frame at most, the rest of a long frame is dropped
+#define SIM_MAX_BULLETS 4096
+#define SIM_WORLD_WIDTH 1280.0f         // Minimum play area, grown to cover every obstacle
+#define SIM_WORLD_HEIGHT 720.0f
+
+#define PLAYER_RADIUS 12.0f
+#define PLAYER_ACCELERATION 1800.0f
+#define PLAYER_DAMPING 4.0f             // Fraction of velocity lost per second
+#define BULLET_RADIUS 2.0f
+#define BULLET_SPEED 1400.0f
+#define BULLET_LIFETIME 1.5f            // Seconds
+#define FIRE_INTERVAL 0.05f             // Seconds between shots
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Player input for one step
+typedef struct SimInput {
+    Vector2 move;       // Desired direction, length <= 1
+    Vector2 aim;        // Firing direction, zero keeps the current heading
+    bool fire;
+} SimInput;
+
+// Bullet state next to its pooled position and velocity
+typedef struct Bullet {
+    Vector2 previous;   // Position before the last step
+    float life;         // Seconds left
+} Bullet;
+
+// Fixed timestep clock type
+typedef struct FixedClock {
+    double accumulator;
+    float step;         // Seconds per step
+} FixedClock;
+
+// Simulation state type
+typedef struct Simulation {
+    Obstacles obstacles;
+    Grid grid;
+    Aabb world;                 // Area the player is kept inside
+
+    Vector2 playerPosition;
+    Vector2 playerPrevious;
+    Vector2 playerVelocity;
+    Vector2 playerHeading;
+    float fireCooldown;
+
+    Pool<Bullet> bullets;
+
+    Vector2* bulletMotions;     // Per-step scratch for the swept collision pass
+    Impact* bulletImpacts;
+    int* bulletHitIds;
+
+    Rng rng;
+    uint64_t tick;
+    int hits;                   // Bullets stopped by obstacles so far
+    int shotsFired;             // Bullets spawned so far
+} Simulation;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+// Create a clock producing tickRate steps per second
+FixedClock LoadFixedClock(int tickRate);
+
+// Add frame time to the clock, returns how many steps to run this frame
+int AdvanceClock(FixedClock* clock, double frameTime);
+
+// Get how far the clock is between the last step and the next one (0..1), for interpolated rendering
+float GetClockAlpha(const FixedClock* clock);
+
+// Load obstacles and set up the initial state
+Simulation LoadSimulation(const char* obstaclesFileName, uint64_t seed);
+
+// Free simulation data
+void UnloadSimulation(Simulation sim);
+
+// Advance the simulation by one step of dt seconds
+void StepSimulation(Simulation* sim, SimInput input, float dt);
@@ -0,0 +1,673 @@
+#pragma once
+#include "MathBatch.h"
+#include "AlignedAlloc.h"
+
+// Structure-of-arrays vector containers.
+// Components live in separate aligned arrays so each kernel streams whole cache lines of x, y (and z).
+// Use Gather/Scatter to convert from/to Vector2 and Vector3 arrays.
+// NOTE: Binary kernels operate on the first stream's count, all streams must hold at least that many elements
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define STREAM_ALIGNMENT 32     // Byte alignment of each component array (AVX register width)
+#define STREAM_PADDING 8        // Capacity is rounded up to a multiple of this many floats
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Vector2 stream type
+typedef struct Vector2Stream {
+    float* x;
+    float* y;
+    int count;
+    int capacity;
+} Vector2Stream;
+
+// Vector3 stream type
+typedef struct Vector3Stream {
+    float* x;
+    float* y;
+    float* z;
+    int count;
+    int capacity;
+} Vector3Stream;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Stream management
+//----------------------------------------------------------------------------------
+
+// Allocate a Vector2 stream with room for capacity elements (count starts at 0)
+RMAPI Vector2Stream LoadVector2Stream(int capacity)
+{
+    Vector2Stream stream = { 0 };
+
+    capacity = (capacity + STREAM_PADDING - 1) / STREAM_PADDING * STREAM_PADDING;
+    float* data = (float*)AlignedAlloc(sizeof(float) * capacity * 2, STREAM_ALIGNMENT);
+    if (data == nullptr) return stream;
+
+    stream.x = data;
+    stream.y = data + capacity;
+    stream.capacity = capacity;
+
+    return stream;
+}
+
+// Free a Vector2 stream
+RMAPI void UnloadVector2Stream(Vector2Stream stream)
+{
+    AlignedFree(stream.x);
+}
+
+// Allocate a Vector3 stream with room for capacity elements (count starts at 0)
+RMAPI Vector3Stream LoadVector3Stream(int capacity)
+{
+    Vector3Stream stream = { 0 };
+
+    capacity = (capacity + STREAM_PADDING - 1) / STREAM_PADDING * STREAM_PADDING;
+    float* data = (float*)AlignedAlloc(sizeof(float) * capacity * 3, STREAM_ALIGNMENT);
+    if (data == nullptr) return stream;
+
+    stream.x = data;
+    stream.y = data + capacity;
+    stream.z = data + capacity * 2;
+    stream.capacity = capacity;
+
+    return stream;
+}
+
+// Free a Vector3 stream
+RMAPI void UnloadVector3Stream(Vector3Stream stream)
+{
+    AlignedFree(stream.x);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Vector2 stream math
+//----------------------------------------------------------------------------------
+
+// Copy a Vector2 array into the stream (count is clamped to capacity)
+RMAPI void Gather(const Vector2* v, int count, Vector2Stream* out)
+{
+    int i = 0;
+    if (count > out->capacity) count = out->capacity;
+
+#if defined(MATH_SSE2)
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 a = _mm_loadu_ps(&v[i].x);
+        __m128 b = _mm_loadu_ps(&v[i + 2].x);
+        _mm_store_ps(out->x + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_store_ps(out->y + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+#elif defined(MATH_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x2_t xy = vld2q_f32(&v[i].x);
+        vst1q_f32(out->x + i, xy.val[0]);
+        vst1q_f32(out->y + i, xy.val[1]);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        out->x[i] = v[i].x;
+        out->y[i] = v[i].y;
+    }
+
+    out->count = count;
+}
+
+// Copy the stream into a Vector2 array of at least stream->count elements
+RMAPI void Scatter(const Vector2Stream* stream, Vector2* out)
+{
+    int i = 0;
+    int count = stream->count;
+
+#if defined(MATH_SSE2)
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x = _mm_load_ps(stream->x + i);
+        __m128 y = _mm_load_ps(stream->y + i);
+        _mm_storeu_ps(&out[i].x, _mm_unpacklo_ps(x, y));
+        _mm_storeu_ps(&out[i + 2].x, _mm_unpackhi_ps(x, y));
+    }
+#elif defined(MATH_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x2_t xy;
+        xy.val[0] = vld1q_f32(stream->x + i);
+        xy.val[1] = vld1q_f32(stream->y + i);
+        vst2q_f32(&out[i].x, xy);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        out[i].x = stream->x[i];
+        out[i].y = stream->y[i];
+    }
+}
+
+// Add two streams (out = v1 + v2)
+RMAPI void Add(const Vector2Stream* v1, const Vector2Stream* v2, Vector2Stream* out)
+{
+    AddFloats(v1->x, v2->x, out->x, v1->count);
+    AddFloats(v1->y, v2->y, out->y, v1->count);
+    out->count = v1->count;
+}
+
+// Scale stream (out = v * scale)
+RMAPI void Scale(const Vector2Stream* v, float scale, Vector2Stream* out)
+{
+    ScaleFloats(v->x, scale, out->x, v->count);
+    ScaleFloats(v->y, scale, out->y, v->count);
+    out->count = v->count;
+}
+
+// Add scaled stream, ie integrate positions by velocities (out = v + dir * scale)
+RMAPI void AddScaled(const Vector2Stream* v, const Vector2Stream* dir, float scale, Vector2Stream* out)
+{
+    AddScaledFloats(v->x, dir->x, scale, out->x, v->count);
+    AddScaledFloats(v->y, dir->y, scale, out->y, v->count);
+    out->count = v->count;
+}
+
+// Calculate the length of every vector in the stream
+RMAPI void Length(const Vector2Stream* v, float* out)
+{
+    int i = 0;
+
+#if defined(MATH_SIMD4)
+    for (; i + 4 <= v->count; i += 4)
+    {
+        float4 x = Load4(v->x + i);
+        float4 y = Load4(v->y + i);
+        Store4(out + i, Sqrt4(Add4(Mul4(x, x), Mul4(y, y))));
+    }
+#endif
+
+    for (; i < v->count; i++) out[i] = sqrtf(v->x[i] * v->x[i] + v->y[i] * v->y[i]);
+}
+
+// Normalize every vector in the stream (zero vectors stay zero)
+RMAPI void Normalize(const Vector2Stream* v, Vector2Stream* out)
+{
+    int i = 0;
+
+#if defined(MATH_SIMD4)
+    for (; i + 4 <= v->count; i += 4)
+    {
+        float4 x = Load4(v->x + i);
+        float4 y = Load4(v->y + i);
+        float4 ilength = SafeReciprocal4(Sqrt4(Add4(Mul4(x, x), Mul4(y, y))));
+        Store4(out->x + i, Mul4(x, ilength));
+        Store4(out->y + i, Mul4(y, ilength));
+    }
+#endif
+
+    for (; i < v->count; i++)
+    {
+        Vector2 n = Normalize(Vector2{ v->x[i], v->y[i] });
+        out->x[i] = n.x;
+        out->y[i] = n.y;
+    }
+
+    out->count = v->count;
+}
+
+// Calculate square distance between two streams
+RMAPI void DistanceSqr(const Vector2Stream* v1, const Vector2Stream* v2, float* out)
+{
+    int i = 0;
+
+#if defined(MATH_SIMD4)
+    for (; i + 4 <= v1->count; i += 4)
+    {
+        float4 dx = Sub4(Load4(v1->x + i), Load4(v2->x + i));
+        float4 dy = Sub4(Load4(v1->y + i), Load4(v2->y + i));
+        Store4(out + i, Add4(Mul4(dx, dx), Mul4(dy, dy)));
+    }
+#endif
+
+    for (; i < v1->count; i++)
+    {
+        float dx = v1->x[i] - v2->x[i];
+        float dy = v1->y[i] - v2->y[i];
+        out[i] = dx * dx + dy * dy;
+    }
+}
+
+// Calculate square distance between every vector in the stream and a point
+RMAPI void DistanceSqr(const Vector2Stream* v, Vector2 point, float* out)
+{
+    int i = 0;
+
+#if defined(MATH_SIMD4)
+    float4 px = Set4(point.x);
+    float4 py = Set4(point.y);
+    for (; i + 4 <= v->count; i += 4)
+    {
+        float4 dx = Sub4(Load4(v->x + i), px);
+        float4 dy = Sub4(Load4(v->y + i), py);
+        Store4(out + i, Add4(Mul4(dx, dx), Mul4(dy, dy)));
+    }
+#endif
+
+    for (; i < v->count; i++)
+    {
+        float dx = v->x[i] - point.x;
+        float dy = v->y[i] - point.y;
+        out[i] = dx * dx + dy * dy;
+    }
+}
+
+// Clamp the components of every vector between min and max
+RMAPI void Clamp(const Vector2Stream* v, Vector2 min, Vector2 max, Vector2Stream* out)
+{
+    int i = 0;
+
+#if defined(MATH_SIMD4)
+    float4 minX = Set4(min.x), minY = Set4(min.y);
+    float4 maxX = Set4(max.x), maxY = Set4(max.y);
+    for (; i + 4 <= v->count; i += 4)
+    {
+        Store4(out->x + i, Min4(maxX, Max4(minX, Load4(v->x + i))));
+        Store4(out->y + i, Min4(maxY, Max4(minY, Load4(v->y + i))));
+    }
+#endif
+
+    for (; i < v->count; i++)
+    {
+        out->x[i] = fminf(max.x, fmaxf(min.x, v->x[i]));
+        out->y[i] = fminf(max.y, fmaxf(min.y, v->y[i]));
+    }
+
+    out->count = v->count;
+}
+
+// Clamp the magnitude of every vector between min and max
+RMAPI void Clamp(const Vector2Stream* v, float min, float max, Vector2Stream* out)
+{
+    int i = 0;
+
+#if defined(MATH_SIMD4)
+    float4 zero = Set4(0.0f);
+    float4 minLength = Set4(min);
+    float4 maxLength = Set4(max);
+    for (; i + 4 <= v->count; i += 4)
+    {
+        float4 x = Load4(v->x + i);
+        float4 y = Load4(v->y + i);
+        float4 length = Sqrt4(Add4(Mul4(x, x), Mul4(y, y)));
+
+        // Same branch order as Clamp(Vector2, float, float): raise to min first, else cap at max
+        float4 target = Select4(Greater4(minLength, length), minLength, Min4(length, maxLength));
+        float4 scale = Select4(Greater4(length, zero), Div4(target, length), Set4(1.0f));
+        Store4(out->x + i, Mul4(x, scale));
+        Store4(out->y + i, Mul4(y, scale));
+    }
+#endif
+
+    for (; i < v->count; i++)
+    {
+        Vector2 c = Clamp(Vector2{ v->x[i], v->y[i] }, min, max);
+        out->x[i] = c.x;
+        out->y[i] = c.y;
+    }
+
+    out->count = v->count;
+}
+
+// Move every vector towards its target by at most maxDistance
+RMAPI void MoveTowards(const Vector2Stream* v, const Vector2Stream* target, float maxDistance, Vector2Stream* out)
+{
+    int i = 0;
+
+#if defined(MATH_SIMD4)
+    float4 step = Set4(maxDistance);
+    float4 reach = Set4((maxDistance >= 0.0f) ? maxDistance * maxDistance : 0.0f);
+    for (; i + 4 <= v->count; i += 4)
+    {
+        float4 x = Load4(v->x + i);
+        float4 y = Load4(v->y + i);
+        float4 tx = Load4(target->x + i);
+        float4 ty = Load4(target->y + i);
+        float4 dx = Sub4(tx, x);
+        float4 dy = Sub4(ty, y);
+        float4 value = Add4(Mul4(dx, dx), Mul4(dy, dy));
+
+        // Snap to target when within reach (value == 0 is always within reach)
+        mask4 arrived = LessEqual4(value, reach);
+        float4 scale = Mul4(step, SafeReciprocal4(Sqrt4(value)));
+        Store4(out->x + i, Select4(arrived, tx, Add4(x, Mul4(dx, scale))));
+        Store4(out->y + i, Select4(arrived, ty, Add4(y, Mul4(dy, scale))));
+    }
+#endif
+
+    for (; i < v->count; i++)
+    {
+        Vector2 m = MoveTowards(Vector2{ v->x[i], v->y[i] }, Vector2{ target->x[i], target->y[i] }, maxDistance);
+        out->x[i] = m.x;
+        out->y[i] = m.y;
+    }
+
+    out->count = v->count;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Vector3 stream math
+//----------------------------------------------------------------------------------
+
+// Copy a Vector3 array into the stream (count is clamped to capacity)
+RMAPI void Gather(const Vector3* v, int count, Vector3Stream* out)
+{
+    int i = 0;
+    if (count > out->capacity) count = out->capacity;
+
+#if defined(MATH_SSE2)
+    for (; i + 4 <= count; i += 4)
+    {
+        const float* src = &v[i].x;
+        __m128 x, y, z;
+        Deinterleave3(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), &x, &y, &z);
+        _mm_store_ps(out->x + i, x);
+        _mm_store_ps(out->y + i, y);
+        _mm_store_ps(out->z + i, z);
+    }
+#elif defined(MATH_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t xyz = vld3q_f32(&v[i].x);
+        vst1q_f32(out->x + i, xyz.val[0]);
+        vst1q_f32(out->y + i, xyz.val[1]);
+        vst1q_f32(out->z + i, xyz.val[2]);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        out->x[i] = v[i].x;
+        out->y[i] = v[i].y;
+        out->z[i] = v[i].z;
+    }
+
+    out->count = count;
+}
+
+// Copy the stream into a Vector3 array of at least stream->count elements
+RMAPI void Scatter(const Vector3Stream* stream, Vector3* out)
+{
+    int i = 0;
+    int count = stream->count;
+
+#if defined(MATH_SSE2)
+    for (; i + 4 <= count; i += 4)
+    {
+        float* dst = &out[i].x;
+        __m128 a, b, c;
+        Interleave3(_mm_load_ps(stream->x + i), _mm_load_ps(stream->y + i), _mm_load_ps(stream->z + i), &a, &b, &c);
+        _mm_storeu_ps(dst, a);
+        _mm_storeu_ps(dst + 4, b);
+        _mm_storeu_ps(dst + 8, c);
+    }
+#elif defined(MATH_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t xyz;
+        xyz.val[0] = vld1q_f32(stream->x + i);
+        xyz.val[1] = vld1q_f32(stream->y + i);
+        xyz.val[2] = vld1q_f32(stream->z + i);
+        vst3q_f32(&out[i].x, xyz);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        out[i].x = stream->x[i];
+        out[i].y = stream->y[i];
+        out[i].z = stream->z[i];
+    }
+}
+
+// Add two streams (out = v1 + v2)
+RMAPI void Add(const Vector3Stream* v1, const Vector3Stream* v2, Vector3Stream* out)
+{
+    AddFloats(v1->x, v2->x, out->x, v1->count);
+    AddFloats(v1->y, v2->y, out->y, v1->count);
+    AddFloats(v1->z, v2->z, out->z, v1->count);
+    out->count = v1->count;
+}
+
+// Scale stream (out = v * scale)
+RMAPI void Scale(const Vector3Stream* v, float scale, Vector3Stream* out)
+{
+    ScaleFloats(v->x, scale, out->x, v->count);
+    ScaleFloats(v->y, scale, out->y, v->count);
+    ScaleFloats(v->z, scale, out->z, v->count);
+    out->count = v->count;
+}
+
+// Add scaled stream, ie integrate positions by velocities (out = v + dir * scale)
+RMAPI void AddScaled(const Vector3Stream* v, const Vector3Stream* dir, float scale, Vector3Stream* out)
+{
+    AddScaledFloats(v->x, dir->x, scale, out->x, v->count);
+    AddScaledFloats(v->y, dir->y, scale, out->y, v->count);
+    AddScaledFloats(v->z, dir->z, scale, out->z, v->count);
+    out->count = v->count;
+}
+
+// Calculate the length of every vector in the stream
+RMAPI void Length(const Vector3Stream* v, float* out)
+{
+    int i = 0;
+
+#if defined(MATH_SIMD4)
+    for (; i + 4 <= v->count; i += 4)
+    {
+        float4 x = Load4(v->x + i);
+        float4 y = Load4(v->y + i);
+        float4 z = Load4(v->z + i);
+        Store4(out + i, Sqrt4(Add4(Add4(Mul4(x, x), Mul4(y, y)), Mul4(z, z))));
+    }
+#endif
+
+    for (; i < v->count; i++) out[i] = sqrtf(v->x[i] * v->x[i] + v->y[i] * v->y[i] + v->z[i] * v->z[i]);
+}
+
+// Normalize every vector in the stream (zero vectors stay zero)
+RMAPI void Normalize(const Vector3Stream* v, Vector3Stream* out)
+{
+    int i = 0;
+
+#if defined(MATH_SIMD4)
+    for (; i + 4 <= v->count; i += 4)
+    {
+        float4 x = Load4(v->x + i);
+        float4 y = Load4(v->y + i);
+        float4 z = Load4(v->z + i);
+        float4 ilength = SafeReciprocal4(Sqrt4(Add4(Add4(Mul4(x, x), Mul4(y, y)), Mul4(z, z))));
+        Store4(out->x + i, Mul4(x, ilength));
+        Store4(out->y + i, Mul4(y, ilength));
+        Store4(out->z + i, Mul4(z, ilength));
+    }
+#endif
+
+    for (; i < v->count; i++)
+    {
+        Vector3 n = Normalize(Vector3{ v->x[i], v->y[i], v->z[i] });
+        out->x[i] = n.x;
+        out->y[i] = n.y;
+        out->z[i] = n.z;
+    }
+
+    out->count = v->count;
+}
+
+// Calculate square distance between two streams
+RMAPI void DistanceSqr(const Vector3Stream* v1, const Vector3Stream* v2, float* out)
+{
+    int i = 0;
+
+#if defined(MATH_SIMD4)
+    for (; i + 4 <= v1->count; i += 4)
+    {
+        float4 dx = Sub4(Load4(v1->x + i), Load4(v2->x + i));
+        float4 dy = Sub4(Load4(v1->y + i), Load4(v2->y + i));
+        float4 dz = Sub4(Load4(v1->z + i), Load4(v2->z + i));
+        Store4(out + i, Add4(Add4(Mul4(dx, dx), Mul4(dy, dy)), Mul4(dz, dz)));
+    }
+#endif
+
+    for (; i < v1->count; i++)
+    {
+        float dx = v1->x[i] - v2->x[i];
+        float dy = v1->y[i] - v2->y[i];
+        float dz = v1->z[i] - v2->z[i];
+        out[i] = dx * dx + dy * dy + dz * dz;
+    }
+}
+
+// Calculate square distance between every vector in the stream and a point
+RMAPI void DistanceSqr(const Vector3Stream* v, Vector3 point, float* out)
+{
+    int i = 0;
+
+#if defined(MATH_SIMD4)
+    float4 px = Set4(point.x);
+    float4 py = Set4(point.y);
+    float4 pz = Set4(point.z);
+    for (; i + 4 <= v->count; i += 4)
+    {
+        float4 dx = Sub4(Load4(v->x + i), px);
+        float4 dy = Sub4(Load4(v->y + i), py);
+        float4 dz = Sub4(Load4(v->z + i), pz);
+        Store4(out + i, Add4(Add4(Mul4(dx, dx), Mul4(dy, dy)), Mul4(dz, dz)));
+    }
+#endif
+
+    for (; i < v->count; i++)
+    {
+        float dx = v->x[i] - point.x;
+        float dy = v->y[i] - point.y;
+        float dz = v->z[i] - point.z;
+        out[i] = dx * dx + dy * dy + dz * dz;
+    }
+}
+
+// Clamp the components of every vector between min and max
+RMAPI void Clamp(const Vector3Stream* v, Vector3 min, Vector3 max, Vector3Stream* out)
+{
+    int i = 0;
+
+#if defined(MATH_SIMD4)
+    float4 minX = Set4(min.x), minY = Set4(min.y), minZ = Set4(min.z);
+    float4 maxX = Set4(max.x), maxY = Set4(max.y), maxZ = Set4(max.z);
+    for (; i + 4 <= v->count; i += 4)
+    {
+        Store4(out->x + i, Min4(maxX, Max4(minX, Load4(v->x + i))));
+        Store4(out->y + i, Min4(maxY, Max4(minY, Load4(v->y + i))));
+        Store4(out->z + i, Min4(maxZ, Max4(minZ, Load4(v->z + i))));
+    }
+#endif
+
+    for (; i < v->count; i++)
+    {
+        out->x[i] = fminf(max.x, fmaxf(min.x, v->x[i]));
+        out->y[i] = fminf(max.y, fmaxf(min.y, v->y[i]));
+        out->z[i] = fminf(max.z, fmaxf(min.z, v->z[i]));
+    }
+
+    out->count = v->count;
+}
+
+// Clamp the magnitude of every vector between min and max
+RMAPI void Clamp(const Vector3Stream* v, float min, float max, Vector3Stream* out)
+{
+    int i = 0;
+
+#if defined(MATH_SIMD4)
+    float4 zero = Set4(0.0f);
+    float4 minLength = Set4(min);
+    float4 maxLength = Set4(max);
+    for (; i + 4 <= v->count; i += 4)
+    {
+        float4 x = Load4(v->x + i);
+        float4 y = Load4(v->y + i);
+        float4 z = Load4(v->z + i);
+        float4 length = Sqrt4(Add4(Add4(Mul4(x, x), Mul4(y, y)), Mul4(z, z)));
+
+        // Same branch order as Clamp(Vector3, float, float): raise to min first, else cap at max
+        float4 target = Select4(Greater4(minLength, length), minLength, Min4(length, maxLength));
+        float4 scale = Select4(Greater4(length, zero), Div4(target, length), Set4(1.0f));
+        Store4(out->x + i, Mul4(x, scale));
+        Store4(out->y + i, Mul4(y, scale));
+        Store4(out->z + i, Mul4(z, scale));
+    }
+#endif
+
+    for (; i < v->count; i++)
+    {
+        Vector3 c = Clamp(Vector3{ v->x[i], v->y[i], v->z[i] }, min, max);
+        out->x[i] = c.x;
+        out->y[i] = c.y;
+        out->z[i] = c.z;
+    }
+
+    out->count = v->count;
+}
+
+// Move every vector towards its target by at most maxDistance
+RMAPI void MoveTowards(const Vector3Stream* v, const Vector3Stream* target, float maxDistance, Vector3Stream* out)
+{
+    int i = 0;
+
+#if defined(MATH_SIMD4)
+    float4 step = Set4(maxDistance);
+    float4 reach = Set4((maxDistance >= 0.0f) ? maxDistance * maxDistance : 0.0f);
+    for (; i + 4 <= v->count; i += 4)
+    {
+        float4 x = Load4(v->x + i);
+        float4 y = Load4(v->y + i);
+        float4 z = Load4(v->z + i);
+        float4 tx = Load4(target->x + i);
+        float4 ty = Load4(target->y + i);
+        float4 tz = Load4(target->z + i);
+        float4 dx = Sub4(tx, x);
+        float4 dy = Sub4(ty, y);
+        float4 dz = Sub4(tz, z);
+        float4 value = Add4(Add4(Mul4(dx, dx), Mul4(dy, dy)), Mul4(dz, dz));
+
+        // Snap to target when within reach (value == 0 is always within reach)
+        mask4 arrived = LessEqual4(value, reach);
+        float4 scale = Mul4(step, SafeReciprocal4(Sqrt4(value)));
+        Store4(out->x + i, Select4(arrived, tx, Add4(x, Mul4(dx, scale))));
+        Store4(out->y + i, Select4(arrived, ty, Add4(y, Mul4(dy, scale))));
+        Store4(out->z + i, Select4(arrived, tz, Add4(z, Mul4(dz, scale))));
+    }
+#endif
+
+    for (; i < v->count; i++)
+    {
+        float dx = target->x[i] - v->x[i];
+        float dy = target->y[i] - v->y[i];
+        float dz = target->z[i] - v->z[i];
+        float value = dx * dx + dy * dy + dz * dz;
+
+        if ((value == 0) || ((maxDistance >= 0) && (value <= maxDistance * maxDistance)))
+        {
+            out->x[i] = target->x[i];
+            out->y[i] = target->y[i];
+            out->z[i] = target->z[i];
+            continue;
+        }
+
+        float scale = maxDistance / sqrtf(value);
+        out->x[i] = v->x[i] + dx * scale;
+        out->y[i] = v->y[i] + dy * scale;
+        out->z[i] = v->z[i] + dz * scale;
+    }
+
+    out->count = v->count;
+}
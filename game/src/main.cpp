@@ -1,15 +1,193 @@
 #include "rlImGui.h"
+#include "Simulation.h"
+#include "JobSystem.h"
+#include "FrameArena.h"
+#include "AssetStreamer.h"
+#include <cstdlib>
+
+#define FRAME_ARENA_SIZE (1024*1024)    // Per buffer, transient data of one frame
+#define STREAM_BYTE_BUDGET (4*1024*1024) // Per frame GPU upload budget of the asset streamer
+#define STREAM_TIME_BUDGET 0.002        // Per frame, in seconds
+
+// Asset type: texture, image decoded on an I/O thread, uploaded by FinalizeAssets
+static void* DecodeTextureAsset(const AssetSource* source, size_t* uploadBytes)
+{
+    Image image = LoadImageFromMemory(GetFileExtension(source->name), source->data, (int)source->size);
+    if (image.data == nullptr) return nullptr;
+
+    Image* result = (Image*)malloc(sizeof(Image));
+    *result = image;
+    *uploadBytes = (size_t)GetPixelDataSize(image.width, image.height, image.format);
+
+    return result;
+}
+
+static void* UploadTextureAsset(void* decoded)
+{
+    Image* image = (Image*)decoded;
+    Texture2D* texture = (Texture2D*)malloc(sizeof(Texture2D));
+    *texture = LoadTextureFromImage(*image);
+    UnloadImage(*image);
+    free(image);
+
+    if (texture->id == 0)
+    {
+        free(texture);
+        return nullptr;
+    }
+
+    return texture;
+}
+
+static void UnloadImageAsset(void* decoded)
+{
+    UnloadImage(*(Image*)decoded);
+    free(decoded);
+}
+
+static void UnloadTextureAsset(void* asset)
+{
+    UnloadTexture(*(Texture2D*)asset);
+    free(asset);
+}
+
+// Asset type: sound, wave decoded on an I/O thread, handed to the audio device by FinalizeAssets
+static void* DecodeSoundAsset(const AssetSource* source, size_t* uploadBytes)
+{
+    Wave wave = LoadWaveFromMemory(GetFileExtension(source->name), source->data, (int)source->size);
+    if (wave.data == nullptr) return nullptr;
+
+    Wave* result = (Wave*)malloc(sizeof(Wave));
+    *result = wave;
+    *uploadBytes = (size_t)wave.frameCount * wave.channels * wave.sampleSize / 8;
+
+    return result;
+}
+
+static void* UploadSoundAsset(void* decoded)
+{
+    Wave* wave = (Wave*)decoded;
+    Sound* sound = (Sound*)malloc(sizeof(Sound));
+    *sound = LoadSoundFromWave(*wave);
+    UnloadWave(*wave);
+    free(wave);
+
+    return sound;
+}
+
+static void UnloadWaveAsset(void* decoded)
+{
+    UnloadWave(*(Wave*)decoded);
+    free(decoded);
+}
+
+static void UnloadSoundAsset(void* asset)
+{
+    UnloadSound(*(Sound*)asset);
+    free(asset);
+}
+
+// Sample the keyboard and mouse into one simulation input
+static SimInput ReadInput(const Simulation* sim)
+{
+    SimInput input = { 0 };
+
+    if (IsKeyDown(KEY_W) || IsKeyDown(KEY_UP)) input.move.y -= 1.0f;
+    if (IsKeyDown(KEY_S) || IsKeyDown(KEY_DOWN)) input.move.y += 1.0f;
+    if (IsKeyDown(KEY_A) || IsKeyDown(KEY_LEFT)) input.move.x -= 1.0f;
+    if (IsKeyDown(KEY_D) || IsKeyDown(KEY_RIGHT)) input.move.x += 1.0f;
+    input.move = Normalize(input.move);
+
+    input.aim = Subtract(GetMousePosition(), sim->playerPosition);
+    input.fire = IsMouseButtonDown(MOUSE_BUTTON_LEFT) || IsKeyDown(KEY_SPACE);
+
+    return input;
+}
+
 int main(void)
 {
+    SetConfigFlags(FLAG_VSYNC_HINT);
     InitWindow(1280, 720, "Game");
-    SetTargetFPS(60);
+
+    // VSync is only a hint (drivers and compositors can ignore it), cap at the refresh rate as well so
+    // the frame rate stays bounded without it. With VSync on, the swap already takes the whole frame
+    int refreshRate = GetMonitorRefreshRate(GetCurrentMonitor());
+    SetTargetFPS((refreshRate > 0)? refreshRate : 60);
+    InitAudioDevice();
+    InitJobSystem(0);
+
+    // Stream assets in the background, the game runs (with fallbacks) until they are ready
+    AssetStreamer* streamer = LoadAssetStreamer("assets", 0, ASSET_BACKEND_GPU);
+    int textureType = RegisterAssetType(streamer, AssetType{ DecodeTextureAsset, UploadTextureAsset, UnloadImageAsset, UnloadTextureAsset });
+    int soundType = RegisterAssetType(streamer, AssetType{ DecodeSoundAsset, UploadSoundAsset, UnloadWaveAsset, UnloadSoundAsset });
+
+    AssetPack pack = { 0 };
+    if (FileExists("assets.pack")) pack = LoadAssetPack("assets.pack");
+    MountAssetPack(streamer, &pack);
+
+    AssetHandle planeTexture = RequestAsset(streamer, textureType, "textures/plane_diffuse.png", ASSET_PRIORITY_HIGH);
+    AssetHandle laserSound = RequestAsset(streamer, soundType, "audio/laser.mp3", ASSET_PRIORITY_NORMAL);
+
+    Simulation sim = LoadSimulation("assets/data/obstacles.txt", 0);
+    FixedClock clock = LoadFixedClock(SIM_TICK_RATE);
+    FrameArena frameArena = LoadFrameArena(FRAME_ARENA_SIZE);
+
     while (!WindowShouldClose())
     {
+        BeginArenaFrame(&frameArena);
+        FinalizeAssets(streamer, STREAM_BYTE_BUDGET, STREAM_TIME_BUDGET);
+
+        // Simulate: as many fixed steps as the elapsed frame time covers
+        SimInput input = ReadInput(&sim);
+        int steps = AdvanceClock(&clock, GetFrameTime());
+        int shotsFired = sim.shotsFired;
+        for (int i = 0; i < steps; i++) StepSimulation(&sim, input, clock.step);
+
+        // NOTE: Shots are counted, bullets expiring in the same steps don't hide them
+        Sound* laser = (Sound*)GetAsset(streamer, laserSound);
+        if ((laser != nullptr) && (sim.shotsFired > shotsFired)) PlaySound(*laser);
+
+        // Render: blend the last two simulation states
+        float alpha = GetClockAlpha(&clock);
+
         BeginDrawing();
         ClearBackground(RAYWHITE);
-        DrawText("Hello World!", 16, 9, 20, RED);
+
+        for (int i = 0; i < sim.obstacles.count; i++)
+        {
+            DrawRectangleV(Vector2{ sim.obstacles.x[i], sim.obstacles.y[i] }, Vector2{ sim.obstacles.w[i], sim.obstacles.h[i] }, DARKGRAY);
+        }
+
+        for (int i = 0; i < sim.bullets.count; i++)
+        {
+            DrawCircleV(Lerp(sim.bullets.items[i].previous, sim.bullets.positions[i], alpha), BULLET_RADIUS, RED);
+        }
+
+        Vector2 player = Lerp(sim.playerPrevious, sim.playerPosition, alpha);
+        Texture2D* texture = (Texture2D*)GetAsset(streamer, planeTexture);
+        if (texture != nullptr)
+        {
+            Rectangle source = { 0.0f, 0.0f, (float)texture->width, (float)texture->height };
+            Rectangle dest = { player.x, player.y, PLAYER_RADIUS * 2.0f, PLAYER_RADIUS * 2.0f };
+            DrawTexturePro(*texture, source, dest, Vector2{ PLAYER_RADIUS, PLAYER_RADIUS }, 0.0f, WHITE);
+        }
+        else DrawCircleV(player, PLAYER_RADIUS, DARKBLUE);
+        DrawLineV(player, Add(player, Scale(sim.playerHeading, PLAYER_RADIUS * 1.5f)), DARKBLUE);
+
+        FrameArenaStats arenaStats = GetFrameArenaStats(&frameArena);
+        AssetStreamStats streamStats = GetAssetStreamStats(streamer);
+        DrawText(FrameFormat(&frameArena, "%i FPS  tick %llu  bullets %i  hits %i", GetFPS(), (unsigned long long)sim.tick, sim.bullets.count, sim.hits), 16, 9, 20, RED);
+        DrawText(FrameFormat(&frameArena, "frame arena %zu / %zu KB, peak %zu KB", arenaStats.lastFrameUsed / 1024, arenaStats.capacity / 1024, arenaStats.peakUsed / 1024), 16, 33, 10, DARKGRAY);
+        DrawText(FrameFormat(&frameArena, "assets %i ready, %i streaming, %i failed", streamStats.ready, streamStats.queued + streamStats.loading + streamStats.decoded, streamStats.failed), 16, 45, 10, DARKGRAY);
         EndDrawing();
     }
+
+    UnloadFrameArena(frameArena);
+    UnloadSimulation(sim);
+    UnloadAssetStreamer(streamer);
+    UnloadAssetPack(pack);
+    ShutdownJobSystem();
+    CloseAudioDevice();
     CloseWindow();
     return 0;
-}
\ No newline at end of file
+}
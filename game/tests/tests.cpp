@@ -0,0 +1,193 @@
+// Tests: runs each case and prints its result, exits with 1 when any case fails.
+//
+// Usage: tests [name]
+//
+// Without a name every case runs.
+
+#include "JobSystem.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define TEST_TIMEOUT_MS 2000        // A counter still not zero by then is reported as a deadlock
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Test case type, returns false on failure
+typedef struct TestCase {
+    const char* name;
+    bool (*run)(void);
+} TestCase;
+
+// Dependency chain job type, each job expects to run right after the one before it
+typedef struct ChainJob {
+    std::atomic<int>* step;
+    std::atomic<bool>* ordered;
+    int position;
+} ChainJob;
+
+// Jobs submitted from a thread outside the job system
+typedef struct ExternalContext {
+    std::thread::id submitter;
+    std::atomic<int> done{ 0 };
+    std::atomic<int> inlined{ 0 };      // Jobs that ran on the submitting thread
+} ExternalContext;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+static void RunChainJob(void* context, int begin, int end)
+{
+    (void)begin;
+    (void)end;
+    ChainJob* job = (ChainJob*)context;
+
+    // Slow enough for the dependent jobs to be picked up by other workers meanwhile
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    if (job->step->load() != job->position) job->ordered->store(false);
+    job->step->fetch_add(1);
+}
+
+static void CountJob(void* context, int begin, int end)
+{
+    ((std::atomic<int>*)context)->fetch_add(end - begin);
+}
+
+static void RunExternalJob(void* context, int begin, int end)
+{
+    ExternalContext* external = (ExternalContext*)context;
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    if (std::this_thread::get_id() == external->submitter) external->inlined.fetch_add(1);
+    external->done.fetch_add(end - begin);
+}
+
+// Poll a counter without helping, so a deadlock shows up as a failure instead of a hang
+static bool WaitWithTimeout(const JobCounter* counter)
+{
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(TEST_TIMEOUT_MS);
+    while (counter->value.load() > 0)
+    {
+        if (std::chrono::steady_clock::now() > deadline) return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return true;
+}
+
+// A -> X -> Z with the submitting thread not helping: no worker may pick up a job before its dependency
+static bool TestDependencyChain(void)
+{
+    std::atomic<int> step{ 0 };
+    std::atomic<bool> ordered{ true };
+    ChainJob jobs[3] = { { &step, &ordered, 0 }, { &step, &ordered, 1 }, { &step, &ordered, 2 } };
+    JobCounter counters[3];
+
+    InitJobSystem(3);
+    RunJob(RunChainJob, &jobs[0], &counters[0]);
+    RunJob(RunChainJob, &jobs[1], &counters[1], &counters[0]);
+    RunJob(RunChainJob, &jobs[2], &counters[2], &counters[1]);
+
+    bool finished = WaitWithTimeout(&counters[0]) && WaitWithTimeout(&counters[1]) && WaitWithTimeout(&counters[2]);
+    if (finished) WaitForCounter(&counters[2]);
+    ShutdownJobSystem();
+
+    return finished && ordered.load() && (step.load() == 3);
+}
+
+// A ParallelFor waiting on a slow job, then a second one waiting on the first
+static bool TestParallelForDependency(void)
+{
+    std::atomic<int> step{ 0 };
+    std::atomic<bool> ordered{ true };
+    std::atomic<int> done{ 0 };
+    ChainJob first = { &step, &ordered, 0 };
+    JobCounter counters[3];
+
+    InitJobSystem(0);
+    RunJob(RunChainJob, &first, &counters[0]);
+    ParallelFor(1000, 7, CountJob, &done, &counters[1], &counters[0]);
+    ParallelFor(1000, 13, CountJob, &done, &counters[2], &counters[1]);
+
+    bool finished = WaitWithTimeout(&counters[2]);
+    if (finished) WaitForCounter(&counters[2]);
+    ShutdownJobSystem();
+
+    return finished && (done.load() == 2000);
+}
+
+// Shutting down right after submitting still runs every job, parked ones included
+static bool TestShutdownDrain(void)
+{
+    std::atomic<int> step{ 0 };
+    std::atomic<bool> ordered{ true };
+    std::atomic<int> done{ 0 };
+    ChainJob first = { &step, &ordered, 0 };
+    JobCounter counters[2];
+
+    InitJobSystem(2);
+    RunJob(RunChainJob, &first, &counters[0]);
+    ParallelFor(4096, 1, CountJob, &done, &counters[1], &counters[0]);
+    ParallelFor(4096, 1, CountJob, &done, nullptr);
+    ShutdownJobSystem();
+
+    return (done.load() == 8192) && (counters[0].value.load() == 0) && (counters[1].value.load() == 0);
+}
+
+// A ParallelFor submitted from a thread the job system doesn't know (like an asset I/O thread) runs on the workers
+static bool TestExternalSubmit(void)
+{
+    ExternalContext context;
+    JobCounter counter;
+    bool finished = false;
+
+    InitJobSystem(2);
+
+    std::thread submitter([&]() {
+        context.submitter = std::this_thread::get_id();
+        ParallelFor(64, 1, RunExternalJob, &context, &counter);
+        finished = WaitWithTimeout(&counter);
+        if (finished) WaitForCounter(&counter);
+    });
+    submitter.join();
+
+    ShutdownJobSystem();
+
+    return finished && (context.done.load() == 64) && (context.inlined.load() == 0);
+}
+
+//----------------------------------------------------------------------------------
+// Main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    static const TestCase cases[] = {
+        { "jobs_dependency_chain", TestDependencyChain },
+        { "jobs_parallel_for_dependency", TestParallelForDependency },
+        { "jobs_shutdown_drain", TestShutdownDrain },
+        { "jobs_external_submit", TestExternalSubmit },
+    };
+
+    const char* filter = (argc > 1)? argv[1] : nullptr;
+    int failed = 0;
+
+    for (const TestCase& test : cases)
+    {
+        if ((filter != nullptr) && (strcmp(filter, test.name) != 0)) continue;
+
+        bool passed = test.run();
+        printf("%-32s %s\n", test.name, passed? "ok" : "FAILED");
+        if (!passed) failed++;
+    }
+
+    return (failed > 0)? 1 : 0;
+}
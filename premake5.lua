@@ -12,6 +12,19 @@ newoption
 	default = "opengl33"
 }
 
+newoption
+{
+	trigger = "simd",
+	value = "INSTRUCTION_SET",
+	description = "vector instruction set for the Math.h batch kernels",
+	allowed = {
+		{ "sse2", "SSE2"},
+		{ "avx2", "AVX2"},
+		{ "none", "Scalar fallback only"}
+	},
+	default = "sse2"
+}
+
 function define_C()
 	language "C"
 end
@@ -78,6 +91,12 @@ workspace "game_concepts"
 	filter "configurations:Release"
 		defines { "NDEBUG" }
 		optimize "On"	
+
+	filter "options:simd=avx2"
+		vectorextensions "AVX2"
+
+	filter "options:simd=none"
+		defines { "MATH_NO_SIMD" }
 		
 	filter { "platforms:x64" }
 		architecture "x86_64"
@@ -86,7 +105,7 @@ workspace "game_concepts"
 	
 
 	cdialect "C99"
-	cppdialect "C++11"
+	cppdialect "C++20"
 	check_raylib()
 	check_imgui()
 
@@ -99,7 +118,7 @@ project "rlImGui"
 	language "C++"
 	
 	include_raylib()
-	includedirs { "rlImGui", "imgui", "imgui-master"}
+	includedirs { "./", "rlImGui", "imgui", "imgui-master"}
 	vpaths 
 	{
 		["Header Files"] = { "*.h"},
@@ -108,7 +127,7 @@ project "rlImGui"
 	}
 	files {"imgui-master/*.h", "imgui-master/*.cpp", "imgui/*.h", "imgui/*.cpp", "*.cpp", "*.h", "extras/**.h"}
 
-	defines {"IMGUI_DISABLE_OBSOLETE_FUNCTIONS","IMGUI_DISABLE_OBSOLETE_KEYIO"}
+	defines {"IMGUI_DISABLE_OBSOLETE_FUNCTIONS","IMGUI_DISABLE_OBSOLETE_KEYIO","IMGUI_USER_CONFIG=\"rlImGuiConfig.h\""}
 
 --[[
 group "Examples"
@@ -157,6 +176,93 @@ project "game"
 		["Source Files"] = {"game/src/**.cpp"},
 	}
 	files {"game/src/**.h", "game/src/**.cpp"}
+	debugdir "game"
 	link_raylib()
 	links {"rlImGui"}
 	includedirs {"./", "imgui", "imgui-master" }
+	defines {"IMGUI_DISABLE_OBSOLETE_FUNCTIONS","IMGUI_DISABLE_OBSOLETE_KEYIO","IMGUI_USER_CONFIG=\"rlImGuiConfig.h\""}
+
+project "headless"
+	kind "ConsoleApp"
+	language "C++"
+	location "_build"
+	targetdir "_bin/%{cfg.buildcfg}"
+	
+	vpaths 
+	{
+		["Header Files"] = {"game/src/**.h"},
+		["Source Files"] = {"game/src/**.cpp", "game/headless/**.cpp"},
+	}
+	files {"game/src/**.h", "game/src/**.cpp", "game/headless/**.cpp"}
+	removefiles {"game/src/main.cpp"}
+	includedirs {"game/src"}
+	debugdir "game"
+
+	filter "system:linux"
+		links {"pthread"}
+
+project "packer"
+	kind "ConsoleApp"
+	language "C++"
+	location "_build"
+	targetdir "_bin/%{cfg.buildcfg}"
+	
+	vpaths 
+	{
+		["Header Files"] = {"game/src/**.h"},
+		["Source Files"] = {"game/src/**.cpp", "game/packer/**.cpp"},
+	}
+	files {"game/src/AssetPack.*", "game/src/Lz4.*", "game/src/MappedFile.*", "game/packer/**.cpp"}
+	includedirs {"game/src"}
+	debugdir "game"
+
+project "levelconv"
+	kind "ConsoleApp"
+	language "C++"
+	location "_build"
+	targetdir "_bin/%{cfg.buildcfg}"
+	
+	vpaths 
+	{
+		["Header Files"] = {"game/src/**.h"},
+		["Source Files"] = {"game/src/**.cpp", "game/levelconv/**.cpp"},
+	}
+	files {"game/src/Obstacles.*", "game/src/MappedFile.*", "game/levelconv/**.cpp"}
+	includedirs {"game/src"}
+	debugdir "game"
+
+project "bench"
+	kind "ConsoleApp"
+	language "C++"
+	location "_build"
+	targetdir "_bin/%{cfg.buildcfg}"
+	
+	vpaths 
+	{
+		["Header Files"] = {"game/src/**.h"},
+		["Source Files"] = {"game/src/**.cpp", "game/bench/**.cpp"},
+	}
+	files {"game/src/Math*.h", "game/src/AabbTree.*", "game/bench/**.cpp"}
+	debugdir "game"
+	link_raylib()
+	links {"rlImGui"}
+	includedirs {"./", "imgui", "imgui-master", "game/src" }
+	defines {"IMGUI_DISABLE_OBSOLETE_FUNCTIONS","IMGUI_DISABLE_OBSOLETE_KEYIO","IMGUI_USER_CONFIG=\"rlImGuiConfig.h\""}
+
+project "tests"
+	kind "ConsoleApp"
+	language "C++"
+	location "_build"
+	targetdir "_bin/%{cfg.buildcfg}"
+	
+	vpaths 
+	{
+		["Header Files"] = {"game/src/**.h"},
+		["Source Files"] = {"game/src/**.cpp", "game/tests/**.cpp"},
+	}
+	files {"game/src/JobSystem.*", "game/tests/**.cpp"}
+	includedirs {"game/src"}
+	debugdir "game"
+
+	filter "system:linux"
+		links {"pthread"}
@@ -30,27 +30,289 @@
 #include "rlImGui.h"
 
 #include "imgui.h"
+#include "imgui_internal.h"
 #include "raylib.h"
+#include "raymath.h"
 #include "rlgl.h"
 
 #ifdef PLATFORM_DESKTOP
 #include <GLFW/glfw3.h>
 #endif
 
+#include <float.h>
 #include <math.h>
-#include <map>
+#include <stddef.h>
+
+#include <mutex>
+#include <utility>
 
 #ifndef NO_FONT_AWESOME
 #include "extras/FA6FreeSolidFontData.h"
 #endif
 
-static Texture2D FontTexture;
+#ifdef RLIMGUI_THREAD_LOCAL_CONTEXT
+thread_local ImGuiContext* rlImGuiThreadImGuiContext = nullptr;
+#endif
+
+// raylib to ImGui key translation, the flat lookup table indexed by raylib key code is built from this list at compile time
+struct rlImGuiKeyPair
+{
+	KeyboardKey raylibKey;
+	ImGuiKey imguiKey;
+};
+
+static constexpr rlImGuiKeyPair RaylibKeyPairs[] =
+{
+	{ KEY_APOSTROPHE, ImGuiKey_Apostrophe },
+	{ KEY_COMMA, ImGuiKey_Comma },
+	{ KEY_MINUS, ImGuiKey_Minus },
+	{ KEY_PERIOD, ImGuiKey_Period },
+	{ KEY_SLASH, ImGuiKey_Slash },
+	{ KEY_ZERO, ImGuiKey_0 },
+	{ KEY_ONE, ImGuiKey_1 },
+	{ KEY_TWO, ImGuiKey_2 },
+	{ KEY_THREE, ImGuiKey_3 },
+	{ KEY_FOUR, ImGuiKey_4 },
+	{ KEY_FIVE, ImGuiKey_5 },
+	{ KEY_SIX, ImGuiKey_6 },
+	{ KEY_SEVEN, ImGuiKey_7 },
+	{ KEY_EIGHT, ImGuiKey_8 },
+	{ KEY_NINE, ImGuiKey_9 },
+	{ KEY_SEMICOLON, ImGuiKey_Semicolon },
+	{ KEY_EQUAL, ImGuiKey_Equal },
+	{ KEY_A, ImGuiKey_A },
+	{ KEY_B, ImGuiKey_B },
+	{ KEY_C, ImGuiKey_C },
+	{ KEY_D, ImGuiKey_D },
+	{ KEY_E, ImGuiKey_E },
+	{ KEY_F, ImGuiKey_F },
+	{ KEY_G, ImGuiKey_G },
+	{ KEY_H, ImGuiKey_H },
+	{ KEY_I, ImGuiKey_I },
+	{ KEY_J, ImGuiKey_J },
+	{ KEY_K, ImGuiKey_K },
+	{ KEY_L, ImGuiKey_L },
+	{ KEY_M, ImGuiKey_M },
+	{ KEY_N, ImGuiKey_N },
+	{ KEY_O, ImGuiKey_O },
+	{ KEY_P, ImGuiKey_P },
+	{ KEY_Q, ImGuiKey_Q },
+	{ KEY_R, ImGuiKey_R },
+	{ KEY_S, ImGuiKey_S },
+	{ KEY_T, ImGuiKey_T },
+	{ KEY_U, ImGuiKey_U },
+	{ KEY_V, ImGuiKey_V },
+	{ KEY_W, ImGuiKey_W },
+	{ KEY_X, ImGuiKey_X },
+	{ KEY_Y, ImGuiKey_Y },
+	{ KEY_Z, ImGuiKey_Z },
+	{ KEY_SPACE, ImGuiKey_Space },
+	{ KEY_ESCAPE, ImGuiKey_Escape },
+	{ KEY_ENTER, ImGuiKey_Enter },
+	{ KEY_TAB, ImGuiKey_Tab },
+	{ KEY_BACKSPACE, ImGuiKey_Backspace },
+	{ KEY_INSERT, ImGuiKey_Insert },
+	{ KEY_DELETE, ImGuiKey_Delete },
+	{ KEY_RIGHT, ImGuiKey_RightArrow },
+	{ KEY_LEFT, ImGuiKey_LeftArrow },
+	{ KEY_DOWN, ImGuiKey_DownArrow },
+	{ KEY_UP, ImGuiKey_UpArrow },
+	{ KEY_PAGE_UP, ImGuiKey_PageUp },
+	{ KEY_PAGE_DOWN, ImGuiKey_PageDown },
+	{ KEY_HOME, ImGuiKey_Home },
+	{ KEY_END, ImGuiKey_End },
+	{ KEY_CAPS_LOCK, ImGuiKey_CapsLock },
+	{ KEY_SCROLL_LOCK, ImGuiKey_ScrollLock },
+	{ KEY_NUM_LOCK, ImGuiKey_NumLock },
+	{ KEY_PRINT_SCREEN, ImGuiKey_PrintScreen },
+	{ KEY_PAUSE, ImGuiKey_Pause },
+	{ KEY_F1, ImGuiKey_F1 },
+	{ KEY_F2, ImGuiKey_F2 },
+	{ KEY_F3, ImGuiKey_F3 },
+	{ KEY_F4, ImGuiKey_F4 },
+	{ KEY_F5, ImGuiKey_F5 },
+	{ KEY_F6, ImGuiKey_F6 },
+	{ KEY_F7, ImGuiKey_F7 },
+	{ KEY_F8, ImGuiKey_F8 },
+	{ KEY_F9, ImGuiKey_F9 },
+	{ KEY_F10, ImGuiKey_F10 },
+	{ KEY_F11, ImGuiKey_F11 },
+	{ KEY_F12, ImGuiKey_F12 },
+	{ KEY_LEFT_SHIFT, ImGuiKey_LeftShift },
+	{ KEY_LEFT_CONTROL, ImGuiKey_LeftCtrl },
+	{ KEY_LEFT_ALT, ImGuiKey_LeftAlt },
+	{ KEY_LEFT_SUPER, ImGuiKey_LeftSuper },
+	{ KEY_RIGHT_SHIFT, ImGuiKey_RightShift },
+	{ KEY_RIGHT_CONTROL, ImGuiKey_RightCtrl },
+	{ KEY_RIGHT_ALT, ImGuiKey_RightAlt },
+	{ KEY_RIGHT_SUPER, ImGuiKey_RightSuper },
+	{ KEY_KB_MENU, ImGuiKey_Menu },
+	{ KEY_LEFT_BRACKET, ImGuiKey_LeftBracket },
+	{ KEY_BACKSLASH, ImGuiKey_Backslash },
+	{ KEY_RIGHT_BRACKET, ImGuiKey_RightBracket },
+	{ KEY_GRAVE, ImGuiKey_GraveAccent },
+	{ KEY_KP_0, ImGuiKey_Keypad0 },
+	{ KEY_KP_1, ImGuiKey_Keypad1 },
+	{ KEY_KP_2, ImGuiKey_Keypad2 },
+	{ KEY_KP_3, ImGuiKey_Keypad3 },
+	{ KEY_KP_4, ImGuiKey_Keypad4 },
+	{ KEY_KP_5, ImGuiKey_Keypad5 },
+	{ KEY_KP_6, ImGuiKey_Keypad6 },
+	{ KEY_KP_7, ImGuiKey_Keypad7 },
+	{ KEY_KP_8, ImGuiKey_Keypad8 },
+	{ KEY_KP_9, ImGuiKey_Keypad9 },
+	{ KEY_KP_DECIMAL, ImGuiKey_KeypadDecimal },
+	{ KEY_KP_DIVIDE, ImGuiKey_KeypadDivide },
+	{ KEY_KP_MULTIPLY, ImGuiKey_KeypadMultiply },
+	{ KEY_KP_SUBTRACT, ImGuiKey_KeypadSubtract },
+	{ KEY_KP_ADD, ImGuiKey_KeypadAdd },
+	{ KEY_KP_ENTER, ImGuiKey_KeypadEnter },
+	{ KEY_KP_EQUAL, ImGuiKey_KeypadEqual },
+};
+
+static constexpr int rlImGuiKeyTableSize()
+{
+	int size = 0;
+	for (const rlImGuiKeyPair& pair : RaylibKeyPairs)
+		size = (pair.raylibKey >= size) ? pair.raylibKey + 1 : size;
+
+	return size;
+}
+
+struct rlImGuiKeyTable
+{
+	ImGuiKey keys[rlImGuiKeyTableSize()];
+};
+
+static constexpr rlImGuiKeyTable rlImGuiBuildKeyTable()
+{
+	rlImGuiKeyTable table = {};
+	for (const rlImGuiKeyPair& pair : RaylibKeyPairs)
+		table.keys[pair.raylibKey] = pair.imguiKey;
+
+	return table;
+}
 
+static constexpr rlImGuiKeyTable RaylibKeyTable = rlImGuiBuildKeyTable();
+
+// streamed GPU buffers for the indexed renderer, used round robin so a frame never overwrites one the GPU may still read
+#define RLIMGUI_STREAM_BUFFER_COUNT 3
+
+struct rlImGuiStreamBuffer
+{
+	unsigned int vao = 0;
+	unsigned int vbo = 0;
+	unsigned int ibo = 0;
+	int vertexCapacity = 0;
+	int indexCapacity = 0;
+};
+
+// raylib input of one frame, captured once on the render thread and applied to every context that takes input
+struct rlImGuiInput
+{
+	unsigned int frame = 0;
+	ImVec2 displaySize;
+	ImVec2 framebufferScale = ImVec2(1.0f, 1.0f);
+	float deltaTime = 0.0f;
+	ImVec2 mousePos;
+	bool mouseDown[3] = {};
+	float mouseWheel = 0.0f;
+	bool keyCtrl = false;
+	bool keyShift = false;
+	bool keyAlt = false;
+	bool keySuper = false;
+
+	// mapped keys down, only these are checked for release each frame
+	KeyboardKey downKeys[IM_ARRAYSIZE(RaylibKeyPairs)] = {};
+	int downKeyCount = 0;
+
+	// keys pressed and text typed this frame, in event order
+	ImVector<KeyboardKey> pressedKeys;
+	ImVector<unsigned int> characters;
+};
+
+// mouse cursor requests of a frame, carried out on the render thread
+struct rlImGuiCursorState
+{
+	ImGuiMouseCursor cursor = ImGuiMouseCursor_Arrow;
+	bool drawCursor = false;
+	bool changeCursor = false;
+	bool setMousePos = false;
+	ImVec2 mousePos;
+};
+
+// font atlas pixels built with the ImGui context, waiting to be uploaded on the render thread
+struct rlImGuiFontPixels
+{
+	ImVector<unsigned char> pixels;
+	int width = 0;
+	int height = 0;
+	int format = 0;
+	bool pending = false;
+};
+
+// a built frame, the draw lists are copies so the frame thread can start the next frame while this one is drawn
+struct rlImGuiFrame
+{
+	ImDrawData drawData;
+	ImVector<ImDrawList*> drawLists;
+	rlImGuiCursorState cursor;
+};
+
+// everything rlImGui keeps for one ImGui context, several can exist side by side
+struct rlImGuiContext
+{
+	ImGuiContext* imgui = nullptr;
+	RenderTexture2D target = {};				// off-screen contexts draw here, id 0 for contexts drawn to the screen
+	bool takesInput = true;
+	ImVec2 inputOrigin;
+
+	Texture2D fontTexture = {};
+	bool fontAtlasAlpha8 = true;
+	rlImGuiFontPixels fontBuild;				// rebuilt atlas of the frame being built
+	rlImGuiFontPixels fontUpload;				// rebuilt atlas handed to the render thread, guarded by frameMutex
+
+	// glyphs added on demand, merged into the glyph ranges of every base (non merge) font at the next frame
+	ImFontGlyphRangesBuilder requestedGlyphs;
+	ImVector<ImWchar> fontGlyphRanges;
+	ImVector<const ImWchar*> baseGlyphRanges;
+	bool fontGlyphsDirty = false;
+
+	// mapped keys reported down to this context, released once they are no longer down in the captured input
+	KeyboardKey downKeys[IM_ARRAYSIZE(RaylibKeyPairs)] = {};
+	int downKeyCount = 0;
+	unsigned int inputFrame = 0;				// last captured input whose events were applied
+
+	rlImGuiStreamBuffer streamBuffers[RLIMGUI_STREAM_BUFFER_COUNT];
+	int currentStreamBuffer = 0;
+	rlImGuiRenderStats renderStats = {};
+
+	// triple buffered frames: one being built, the last one built and the one the render thread draws
+	rlImGuiFrame frames[3];
+	int buildFrame = 0;
+	int readyFrame = 1;
+	int drawFrame = 2;
+	bool frameReady = false;
+	std::mutex frameMutex;
+};
+
+static thread_local rlImGuiContext* CurrentContext = nullptr;
+static int ContextCount = 0;
+
+// shared by all contexts, the renderer choice and the font shader only depend on the OpenGL version
+static bool UseIndexedRendering = false;
+
+// coverage-only (alpha 8) atlases hold the glyph coverage in the red channel, this shader moves it to alpha
+static unsigned int FontShaderId = 0;
+static int FontShaderMvpLoc = -1;
+static int FontShaderTextureLoc = -1;
+
+// there is one window and one mouse cursor whatever the number of contexts
+static rlImGuiInput Input;
+static std::mutex InputMutex;
 static ImGuiMouseCursor CurrentMouseCursor = ImGuiMouseCursor_COUNT;
 static MouseCursor MouseCursorMap[ImGuiMouseCursor_COUNT];
 
-static std::map<KeyboardKey, ImGuiKey> RaylibKeyMap;
-
 static const char* rlImGuiGetClipText(void*) 
 {
 	return GetClipboardText();
@@ -61,116 +323,100 @@ static void rlImGuiSetClipText(void*, const char* text)
 	SetClipboardText(text);
 }
 
-static void rlImGuiNewFrame()
+static ImGuiKey rlImGuiTranslateKey(int key)
+{
+	return (key >= 0 && key < rlImGuiKeyTableSize()) ? RaylibKeyTable.keys[key] : ImGuiKey_None;
+}
+
+// feed the captured input to the current ImGui context
+static void rlImGuiApplyInput(rlImGuiContext* context)
 {
 	ImGuiIO& io = ImGui::GetIO();
+	std::lock_guard<std::mutex> lock(InputMutex);
 
-	if (IsWindowFullscreen())
+	if (context->target.id != 0)
 	{
-		int monitor = GetCurrentMonitor();
-		io.DisplaySize.x = float(GetMonitorWidth(monitor));
-		io.DisplaySize.y = float(GetMonitorHeight(monitor));
+		io.DisplaySize = ImVec2(float(context->target.texture.width), float(context->target.texture.height));
+		io.DisplayFramebufferScale = ImVec2(1.0f, 1.0f);
 	}
 	else
 	{
-		io.DisplaySize.x = float(GetScreenWidth());
-		io.DisplaySize.y = float(GetScreenHeight());
-	}
-
-	int width = int(io.DisplaySize.x), height = int(io.DisplaySize.y);
-#ifdef PLATFORM_DESKTOP
-	glfwGetFramebufferSize(glfwGetCurrentContext(), &width, &height);
-#endif
-	if (width > 0 && height > 0) {
-		io.DisplayFramebufferScale = ImVec2(width / io.DisplaySize.x, height / io.DisplaySize.y);
-	}
-	else {
-		io.DisplayFramebufferScale = ImVec2(1.0f, 1.0f);
+		io.DisplaySize = Input.displaySize;
+		io.DisplayFramebufferScale = Input.framebufferScale;
 	}
 
-	io.DeltaTime = GetFrameTime();
+	io.DeltaTime = Input.deltaTime;
 
-	if (io.WantSetMousePos)
-	{
-		SetMousePosition((int)io.MousePos.x, (int)io.MousePos.y);
-	}
-	else
+	if (!context->takesInput)
 	{
-		io.MousePos.x = (float)GetMouseX();
-		io.MousePos.y = (float)GetMouseY();
+		io.MousePos = ImVec2(-FLT_MAX, -FLT_MAX);
+		io.MouseDown[0] = io.MouseDown[1] = io.MouseDown[2] = false;
+		io.KeyCtrl = io.KeyShift = io.KeyAlt = io.KeySuper = false;
+
+		for (int i = 0; i < context->downKeyCount; i++)
+			io.AddKeyEvent(rlImGuiTranslateKey(context->downKeys[i]), false);
+		context->downKeyCount = 0;
+		context->inputFrame = Input.frame;
+		return;
 	}
 
-	io.MouseDown[0] = IsMouseButtonDown(MOUSE_LEFT_BUTTON);
-	io.MouseDown[1] = IsMouseButtonDown(MOUSE_RIGHT_BUTTON);
-	io.MouseDown[2] = IsMouseButtonDown(MOUSE_MIDDLE_BUTTON);
+	// the render thread moves the mouse when ImGui asks, the position is only read otherwise
+	if (!io.WantSetMousePos)
+		io.MousePos = ImVec2(Input.mousePos.x - context->inputOrigin.x, Input.mousePos.y - context->inputOrigin.y);
 
-	if (GetMouseWheelMove() > 0)
-		io.MouseWheel += 1;
-	else if (GetMouseWheelMove() < 0)
-		io.MouseWheel -= 1;
+	io.MouseDown[0] = Input.mouseDown[0];
+	io.MouseDown[1] = Input.mouseDown[1];
+	io.MouseDown[2] = Input.mouseDown[2];
+
+	io.KeyCtrl = Input.keyCtrl;
+	io.KeyShift = Input.keyShift;
+	io.KeyAlt = Input.keyAlt;
+	io.KeySuper = Input.keySuper;
 
-	if ((io.ConfigFlags & ImGuiConfigFlags_NoMouseCursorChange) == 0)
+	// look for any keys that were down last frame and see if they were released
+	for (int i = 0; i < context->downKeyCount; )
 	{
-		ImGuiMouseCursor imgui_cursor = ImGui::GetMouseCursor();
-		if (imgui_cursor != CurrentMouseCursor || io.MouseDrawCursor)
-		{
-			CurrentMouseCursor = imgui_cursor;
-			if (io.MouseDrawCursor || imgui_cursor == ImGuiMouseCursor_None)
-			{
-				HideCursor();
-			}
-			else
-			{
-				ShowCursor();
+		bool down = false;
+		for (int k = 0; k < Input.downKeyCount && !down; k++)
+			down = (Input.downKeys[k] == context->downKeys[i]);
 
-				if (!(io.ConfigFlags & ImGuiConfigFlags_NoMouseCursorChange))
-				{
-					SetMouseCursor((imgui_cursor > -1 && imgui_cursor < ImGuiMouseCursor_COUNT) ? MouseCursorMap[imgui_cursor] : MOUSE_CURSOR_DEFAULT);
-				}
-			}
+		if (down)
+		{
+			i++;
+			continue;
 		}
+
+		io.AddKeyEvent(rlImGuiTranslateKey(context->downKeys[i]), false);
+		context->downKeys[i] = context->downKeys[--context->downKeyCount];
 	}
-}
 
-static void rlImGuiEvents()
-{
-	ImGuiIO& io = ImGui::GetIO();
+	// events are applied once per capture, a context building several frames per capture doesn't repeat them
+	if (context->inputFrame == Input.frame)
+		return;
 
-	io.KeyCtrl = IsKeyDown(KEY_RIGHT_CONTROL) || IsKeyDown(KEY_LEFT_CONTROL);
-	io.KeyShift = IsKeyDown(KEY_RIGHT_SHIFT) || IsKeyDown(KEY_LEFT_SHIFT);
-	io.KeyAlt = IsKeyDown(KEY_RIGHT_ALT) || IsKeyDown(KEY_LEFT_ALT);
-	io.KeySuper = IsKeyDown(KEY_RIGHT_SUPER) || IsKeyDown(KEY_LEFT_SUPER);
+	context->inputFrame = Input.frame;
+	io.MouseWheel += Input.mouseWheel;
 
-	// get the pressed keys, they are in event order
-	int keyId = GetKeyPressed();
-	while (keyId != 0)
+	for (KeyboardKey keyId : Input.pressedKeys)
 	{
-		auto keyItr = RaylibKeyMap.find(KeyboardKey(keyId));
-		if (keyItr != RaylibKeyMap.end())
-			io.AddKeyEvent(keyItr->second, true);
-		keyId = GetKeyPressed();
-	}
+		io.AddKeyEvent(rlImGuiTranslateKey(keyId), true);
 
-	// look for any keys that were down last frame and see if they were down and are released
-	for (const auto keyItr : RaylibKeyMap)
-	{
-		if (IsKeyReleased(keyItr.first))
-			io.AddKeyEvent(keyItr.second, false);
-	}
+		bool tracked = false;
+		for (int i = 0; i < context->downKeyCount && !tracked; i++)
+			tracked = (context->downKeys[i] == keyId);
 
-	// add the text input in order
-	unsigned int pressed = GetCharPressed();
-	while (pressed != 0)
-	{
-		io.AddInputCharacter(pressed);
-		pressed = GetCharPressed();
+		if (!tracked)
+			context->downKeys[context->downKeyCount++] = keyId;
 	}
+
+	for (unsigned int character : Input.characters)
+		io.AddInputCharacter(character);
 }
 
-static void rlImGuiTriangleVert(ImDrawVert& idx_vert)
+static void rlImGuiTriangleVert(const ImDrawVert& idx_vert)
 {
-	Color* c;
-	c = (Color*)&idx_vert.col;
+	const Color* c;
+	c = (const Color*)&idx_vert.col;
 	rlColor4ub(c->r, c->g, c->b, c->a);
 	rlTexCoord2f(idx_vert.uv.x, idx_vert.uv.y);
 	rlVertex2f(idx_vert.pos.x, idx_vert.pos.y);
@@ -200,9 +446,9 @@ static void rlImGuiRenderTriangles(unsigned int count, int indexStart, const ImV
 		ImDrawIdx indexB = indexBuffer[indexStart + i + 1];
 		ImDrawIdx indexC = indexBuffer[indexStart + i + 2];
 
-		ImDrawVert vertexA = vertBuffer[indexA];
-		ImDrawVert vertexB = vertBuffer[indexB];
-		ImDrawVert vertexC = vertBuffer[indexC];
+		const ImDrawVert& vertexA = vertBuffer[indexA];
+		const ImDrawVert& vertexB = vertBuffer[indexB];
+		const ImDrawVert& vertexC = vertBuffer[indexC];
 
 		rlImGuiTriangleVert(vertexA);
 		rlImGuiTriangleVert(vertexB);
@@ -211,40 +457,429 @@ static void rlImGuiRenderTriangles(unsigned int count, int indexStart, const ImV
 	rlEnd();
 }
 
-static void EnableScissor(float x, float y, float width, float height)
+static void EnableScissor(const ImDrawData* data, float x, float y, float width, float height)
 {
 	rlEnableScissorTest();
-	ImGuiIO& io = ImGui::GetIO();
-	rlScissor((int)(x * io.DisplayFramebufferScale.x),
-		int((GetScreenHeight() - (int)(y + height)) * io.DisplayFramebufferScale.y),
-		(int)(width * io.DisplayFramebufferScale.x),
-		(int)(height * io.DisplayFramebufferScale.y));
+	rlScissor((int)(x * data->FramebufferScale.x),
+		int((data->DisplaySize.y - (int)(y + height)) * data->FramebufferScale.y),
+		(int)(width * data->FramebufferScale.x),
+		(int)(height * data->FramebufferScale.y));
+}
+
+// the indexed renderer draws straight from GPU buffers, it needs vertex buffers (not OpenGL 1.1) and 16 bit indices (what rlDrawVertexArrayElements takes)
+static bool rlImGuiCanRenderIndexed()
+{
+	return (rlGetVersion() != RL_OPENGL_11) && (sizeof(ImDrawIdx) == sizeof(unsigned short));
+}
+
+// make sure a stream buffer can hold a frame of vertices and indices, buffers grow to the next power of two and never shrink
+static void rlImGuiReserveStreamBuffer(rlImGuiStreamBuffer& buffer, int vertexCount, int indexCount)
+{
+	if (buffer.vao == 0)
+		buffer.vao = rlLoadVertexArray();
+
+	if (vertexCount > buffer.vertexCapacity)
+	{
+		int capacity = (buffer.vertexCapacity > 0) ? buffer.vertexCapacity : 4096;
+		while (capacity < vertexCount)
+			capacity *= 2;
+
+		if (buffer.vbo != 0)
+			rlUnloadVertexBuffer(buffer.vbo);
+
+		rlEnableVertexArray(buffer.vao);
+		buffer.vbo = rlLoadVertexBuffer(nullptr, capacity * int(sizeof(ImDrawVert)), true);
+		buffer.vertexCapacity = capacity;
+	}
+
+	if (indexCount > buffer.indexCapacity)
+	{
+		int capacity = (buffer.indexCapacity > 0) ? buffer.indexCapacity : 8192;
+		while (capacity < indexCount)
+			capacity *= 2;
+
+		if (buffer.ibo != 0)
+			rlUnloadVertexBuffer(buffer.ibo);
+
+		rlEnableVertexArray(buffer.vao);
+		buffer.ibo = rlLoadVertexBufferElement(nullptr, capacity * int(sizeof(ImDrawIdx)), true);
+		buffer.indexCapacity = capacity;
+	}
+
+	rlDisableVertexArray();
+}
+
+static void rlImGuiUnloadStreamBuffers(rlImGuiContext* context)
+{
+	for (rlImGuiStreamBuffer& buffer : context->streamBuffers)
+	{
+		if (buffer.vbo != 0)
+			rlUnloadVertexBuffer(buffer.vbo);
+		if (buffer.ibo != 0)
+			rlUnloadVertexBuffer(buffer.ibo);
+		if (buffer.vao != 0)
+			rlUnloadVertexArray(buffer.vao);
+
+		buffer = rlImGuiStreamBuffer();
+	}
+}
+
+// point the vertex attributes at the first vertex of a draw list, indices are relative to it (there is no base vertex draw call)
+static void rlImGuiSetVertexBase(const rlImGuiStreamBuffer& buffer, int vertexBase)
+{
+	int* locs = rlGetShaderLocsDefault();
+	int offset = vertexBase * int(sizeof(ImDrawVert));
+
+	rlEnableVertexBuffer(buffer.vbo);
+	rlSetVertexAttribute(locs[RL_SHADER_LOC_VERTEX_POSITION], 2, RL_FLOAT, false, sizeof(ImDrawVert), offset + int(offsetof(ImDrawVert, pos)));
+	rlEnableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_POSITION]);
+	rlSetVertexAttribute(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_FLOAT, false, sizeof(ImDrawVert), offset + int(offsetof(ImDrawVert, uv)));
+	rlEnableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+	rlSetVertexAttribute(locs[RL_SHADER_LOC_VERTEX_COLOR], 4, RL_UNSIGNED_BYTE, true, sizeof(ImDrawVert), offset + int(offsetof(ImDrawVert, col)));
+	rlEnableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_COLOR]);
+}
+
+static const char* FontVertexShader330 =
+	"#version 330\n"
+	"in vec3 vertexPosition;\n"
+	"in vec2 vertexTexCoord;\n"
+	"in vec4 vertexColor;\n"
+	"out vec2 fragTexCoord;\n"
+	"out vec4 fragColor;\n"
+	"uniform mat4 mvp;\n"
+	"void main()\n"
+	"{\n"
+	"    fragTexCoord = vertexTexCoord;\n"
+	"    fragColor = vertexColor;\n"
+	"    gl_Position = mvp*vec4(vertexPosition, 1.0);\n"
+	"}\n";
+
+static const char* FontFragmentShader330 =
+	"#version 330\n"
+	"in vec2 fragTexCoord;\n"
+	"in vec4 fragColor;\n"
+	"out vec4 finalColor;\n"
+	"uniform sampler2D texture0;\n"
+	"void main()\n"
+	"{\n"
+	"    finalColor = vec4(fragColor.rgb, fragColor.a*texture(texture0, fragTexCoord).r);\n"
+	"}\n";
+
+// GLSL 100 (OpenGL ES) and 120 (OpenGL 2.1) versions, the version line is prepended
+static const char* FontVertexShader100 =
+	"attribute vec3 vertexPosition;\n"
+	"attribute vec2 vertexTexCoord;\n"
+	"attribute vec4 vertexColor;\n"
+	"varying vec2 fragTexCoord;\n"
+	"varying vec4 fragColor;\n"
+	"uniform mat4 mvp;\n"
+	"void main()\n"
+	"{\n"
+	"    fragTexCoord = vertexTexCoord;\n"
+	"    fragColor = vertexColor;\n"
+	"    gl_Position = mvp*vec4(vertexPosition, 1.0);\n"
+	"}\n";
+
+static const char* FontFragmentShader100 =
+	"varying vec2 fragTexCoord;\n"
+	"varying vec4 fragColor;\n"
+	"uniform sampler2D texture0;\n"
+	"void main()\n"
+	"{\n"
+	"    gl_FragColor = vec4(fragColor.rgb, fragColor.a*texture2D(texture0, fragTexCoord).r);\n"
+	"}\n";
+
+static void rlImGuiLoadFontShader()
+{
+	if (FontShaderId != 0)
+		return;
+
+	int version = rlGetVersion();
+	if (version == RL_OPENGL_33 || version == RL_OPENGL_43)
+	{
+		FontShaderId = rlLoadShaderCode(FontVertexShader330, FontFragmentShader330);
+	}
+	else
+	{
+		// the shaders bind their attributes to the default names, so rlgl gives them the default shader locations
+		const char* header = (version == RL_OPENGL_21) ? "#version 120\n" : "#version 100\nprecision mediump float;\n";
+		ImGuiTextBuffer vertex;
+		ImGuiTextBuffer fragment;
+		vertex.append(header);
+		vertex.append(FontVertexShader100);
+		fragment.append(header);
+		fragment.append(FontFragmentShader100);
+
+		FontShaderId = rlLoadShaderCode(vertex.c_str(), fragment.c_str());
+	}
+
+	if (FontShaderId != 0)
+	{
+		FontShaderMvpLoc = rlGetLocationUniform(FontShaderId, "mvp");
+		FontShaderTextureLoc = rlGetLocationUniform(FontShaderId, "texture0");
+	}
+}
+
+static bool rlImGuiUseAlpha8Atlas(const rlImGuiContext* context)
+{
+	return context->fontAtlasAlpha8 && UseIndexedRendering && FontShaderId != 0;
+}
+
+// the render thread picks the shader by what was uploaded, the setting may have changed since
+static bool rlImGuiFontTextureIsAlpha8(const rlImGuiContext* context)
+{
+	return context->fontTexture.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE && FontShaderId != 0;
+}
+
+// bind the buffers and the default shader for indexed drawing, also used to restore state after a user callback
+static bool rlImGuiSetupIndexedState(const rlImGuiContext* context, const rlImGuiStreamBuffer& buffer)
+{
+	bool hasVertexArray = rlEnableVertexArray(buffer.vao);
+	rlEnableVertexBufferElement(buffer.ibo);
+
+	Matrix mvp = MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection());
+	int textureSlot = 0;
+
+	if (rlImGuiFontTextureIsAlpha8(context))
+	{
+		rlEnableShader(FontShaderId);
+		rlSetUniformMatrix(FontShaderMvpLoc, mvp);
+		rlSetUniform(FontShaderTextureLoc, &textureSlot, RL_SHADER_UNIFORM_INT, 1);
+	}
+
+	int* locs = rlGetShaderLocsDefault();
+	rlEnableShader(rlGetShaderIdDefault());
+	rlSetUniformMatrix(locs[RL_SHADER_LOC_MATRIX_MVP], mvp);
+
+	float white[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+	rlSetUniform(locs[RL_SHADER_LOC_COLOR_DIFFUSE], white, RL_SHADER_UNIFORM_VEC4, 1);
+
+	rlSetUniform(locs[RL_SHADER_LOC_MAP_DIFFUSE], &textureSlot, RL_SHADER_UNIFORM_INT, 1);
+	rlActiveTextureSlot(0);
+
+	return hasVertexArray;
+}
+
+// an indexed draw being extended by following commands
+struct rlImGuiPendingDraw
+{
+	int indexStart = 0;
+	int count = 0;
+};
+
+static void rlImGuiFlushPendingDraw(rlImGuiPendingDraw& pending, rlImGuiRenderStats& stats)
+{
+	if (pending.count == 0)
+		return;
+
+	rlDrawVertexArrayElements(pending.indexStart, pending.count, nullptr);
+	stats.draws++;
+	pending.count = 0;
+}
+
+static bool rlImGuiSameClipRect(const ImVec4& a, const ImVec4& b)
+{
+	return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w;
+}
+
+// set the scissor to a command clip rect unless it is the one already set
+static void rlImGuiSetScissor(const ImDrawData* data, const ImVec4& clipRect, bool& scissorSet, ImVec4& scissorRect, rlImGuiRenderStats& stats)
+{
+	if (scissorSet && rlImGuiSameClipRect(clipRect, scissorRect))
+		return;
+
+	EnableScissor(data, clipRect.x - data->DisplayPos.x, clipRect.y - data->DisplayPos.y, clipRect.z - (clipRect.x - data->DisplayPos.x), clipRect.w - (clipRect.y - data->DisplayPos.y));
+	scissorSet = true;
+	scissorRect = clipRect;
+	stats.scissorChanges++;
+}
+
+// draw all lists with one upload per buffer and one indexed draw per command, vertices and indices are copied as is from ImGui's buffers
+static void rlRenderDataIndexed(rlImGuiContext* context, const ImDrawData* data)
+{
+	rlImGuiStreamBuffer& buffer = context->streamBuffers[context->currentStreamBuffer];
+	context->currentStreamBuffer = (context->currentStreamBuffer + 1) % RLIMGUI_STREAM_BUFFER_COUNT;
+	rlImGuiRenderStats& stats = context->renderStats;
+
+	rlImGuiReserveStreamBuffer(buffer, data->TotalVtxCount, data->TotalIdxCount);
+	bool hasVertexArray = rlImGuiSetupIndexedState(context, buffer);
+
+	int vertexBase = 0;
+	int indexBase = 0;
+	for (int l = 0; l < data->CmdListsCount; ++l)
+	{
+		const ImDrawList* commandList = data->CmdLists[l];
+		rlUpdateVertexBuffer(buffer.vbo, commandList->VtxBuffer.Data, commandList->VtxBuffer.Size * int(sizeof(ImDrawVert)), vertexBase * int(sizeof(ImDrawVert)));
+		rlUpdateVertexBufferElements(buffer.ibo, commandList->IdxBuffer.Data, commandList->IdxBuffer.Size * int(sizeof(ImDrawIdx)), indexBase * int(sizeof(ImDrawIdx)));
+		vertexBase += commandList->VtxBuffer.Size;
+		indexBase += commandList->IdxBuffer.Size;
+	}
+
+	// adjacent commands with the same clip rect, texture and vertex base whose indices follow each other are merged into one draw
+	rlImGuiPendingDraw pending = {};
+	int boundVertexBase = -1;
+	unsigned int boundTexture = 0;
+	bool scissorSet = false;
+	ImVec4 scissorRect = {};
+
+	vertexBase = 0;
+	indexBase = 0;
+	for (int l = 0; l < data->CmdListsCount; ++l)
+	{
+		const ImDrawList* commandList = data->CmdLists[l];
+
+		for (const auto& cmd : commandList->CmdBuffer)
+		{
+			stats.commands++;
+
+			if (cmd.UserCallback != nullptr)
+			{
+				rlImGuiFlushPendingDraw(pending, stats);
+				rlImGuiSetScissor(data, cmd.ClipRect, scissorSet, scissorRect, stats);
+				if (cmd.UserCallback != ImDrawCallback_ResetRenderState)
+					cmd.UserCallback(commandList, &cmd);
+
+				// the callback may have touched any state
+				rlImGuiSetupIndexedState(context, buffer);
+				boundVertexBase = -1;
+				boundTexture = 0;
+				scissorSet = false;
+				continue;
+			}
+
+			if (cmd.ElemCount == 0)
+				continue;
+
+			Texture* texture = (Texture*)cmd.TextureId;
+			unsigned int textureId = (texture == nullptr) ? rlGetTextureIdDefault() : texture->id;
+			int commandVertexBase = vertexBase + int(cmd.VtxOffset);
+			int commandIndexStart = indexBase + int(cmd.IdxOffset);
+
+			if (pending.count > 0 && textureId == boundTexture && commandVertexBase == boundVertexBase && commandIndexStart == pending.indexStart + pending.count && rlImGuiSameClipRect(cmd.ClipRect, scissorRect))
+			{
+				pending.count += int(cmd.ElemCount);
+				continue;
+			}
+
+			rlImGuiFlushPendingDraw(pending, stats);
+			rlImGuiSetScissor(data, cmd.ClipRect, scissorSet, scissorRect, stats);
+
+			if (commandVertexBase != boundVertexBase)
+			{
+				rlImGuiSetVertexBase(buffer, commandVertexBase);
+				boundVertexBase = commandVertexBase;
+			}
+
+			if (textureId != boundTexture)
+			{
+				// the alpha 8 font atlas is drawn with the swizzling shader, everything else with the default one
+				unsigned int fontTextureId = context->fontTexture.id;
+				if (rlImGuiFontTextureIsAlpha8(context) && (textureId == fontTextureId) != (boundTexture == fontTextureId))
+					rlEnableShader((textureId == fontTextureId) ? FontShaderId : rlGetShaderIdDefault());
+
+				rlEnableTexture(textureId);
+				boundTexture = textureId;
+				stats.textureBinds++;
+			}
+
+			pending.indexStart = commandIndexStart;
+			pending.count = int(cmd.ElemCount);
+		}
+
+		vertexBase += commandList->VtxBuffer.Size;
+		indexBase += commandList->IdxBuffer.Size;
+	}
+
+	rlImGuiFlushPendingDraw(pending, stats);
+
+	rlDisableTexture();
+	rlDisableShader();
+	if (hasVertexArray)
+	{
+		rlDisableVertexArray();
+	}
+	else
+	{
+		int* locs = rlGetShaderLocsDefault();
+		rlDisableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_POSITION]);
+		rlDisableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+		rlDisableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_COLOR]);
+	}
+	rlDisableVertexBuffer();
+	rlDisableVertexBufferElement();
 }
 
-static void rlRenderData(ImDrawData* data)
+static void rlRenderData(rlImGuiContext* context, const ImDrawData* data)
 {
+	rlImGuiRenderStats& stats = context->renderStats;
+	stats = rlImGuiRenderStats();
 	rlDrawRenderBatchActive();
 	rlDisableBackfaceCulling();
 
+	if (UseIndexedRendering)
+	{
+		rlRenderDataIndexed(context, data);
+
+		rlDisableScissorTest();
+		rlEnableBackfaceCulling();
+		return;
+	}
+
+	// the batch only has to be flushed when the scissor changes, texture switches are handled inside rlgl's batch
+	bool scissorSet = false;
+	ImVec4 scissorRect = {};
+	void* batchTexture = nullptr;
+	bool batchPending = false;
+
 	for (int l = 0; l < data->CmdListsCount; ++l)
 	{
 		const ImDrawList* commandList = data->CmdLists[l];
 
 		for (const auto& cmd : commandList->CmdBuffer)
 		{
-			EnableScissor(cmd.ClipRect.x - data->DisplayPos.x, cmd.ClipRect.y - data->DisplayPos.y, cmd.ClipRect.z - (cmd.ClipRect.x - data->DisplayPos.x), cmd.ClipRect.w - (cmd.ClipRect.y - data->DisplayPos.y));
+			stats.commands++;
+
+			if (!scissorSet || !rlImGuiSameClipRect(cmd.ClipRect, scissorRect) || cmd.UserCallback != nullptr)
+			{
+				if (batchPending)
+				{
+					rlDrawRenderBatchActive();
+					stats.draws++;
+					batchPending = false;
+				}
+
+				rlImGuiSetScissor(data, cmd.ClipRect, scissorSet, scissorRect, stats);
+			}
+
 			if (cmd.UserCallback != nullptr)
 			{
-				cmd.UserCallback(commandList, &cmd);
+				if (cmd.UserCallback != ImDrawCallback_ResetRenderState)
+					cmd.UserCallback(commandList, &cmd);
 
+				scissorSet = false;
 				continue;
 			}
 
+			if (cmd.ElemCount < 3)
+				continue;
+
+			if (batchPending && cmd.TextureId != batchTexture)
+				stats.draws++;
+			if (!batchPending || cmd.TextureId != batchTexture)
+				stats.textureBinds++;
+
 			rlImGuiRenderTriangles(cmd.ElemCount, cmd.IdxOffset, commandList->IdxBuffer, commandList->VtxBuffer, cmd.TextureId);
-			rlDrawRenderBatchActive();
+			batchTexture = cmd.TextureId;
+			batchPending = true;
 		}
 	}
 
+	if (batchPending)
+	{
+		rlDrawRenderBatchActive();
+		stats.draws++;
+	}
+
 	rlSetTexture(0);
 	rlDisableScissorTest();
 	rlEnableBackfaceCulling();
@@ -263,148 +898,236 @@ void SetupMouseCursors()
 	MouseCursorMap[ImGuiMouseCursor_NotAllowed] = MOUSE_CURSOR_NOT_ALLOWED;
 }
 
-void rlImGuiEndInitImGui()
+// read the cursor requests of the frame just rendered by the current ImGui context
+static rlImGuiCursorState rlImGuiGetCursorState()
 {
-	SetupMouseCursors();
+	ImGuiIO& io = ImGui::GetIO();
+
+	rlImGuiCursorState state;
+	state.cursor = ImGui::GetMouseCursor();
+	state.drawCursor = io.MouseDrawCursor;
+	state.changeCursor = (io.ConfigFlags & ImGuiConfigFlags_NoMouseCursorChange) == 0;
+	state.setMousePos = io.WantSetMousePos;
+	state.mousePos = io.MousePos;
+
+	return state;
+}
+
+static void rlImGuiApplyCursorState(const rlImGuiContext* context, const rlImGuiCursorState& state)
+{
+	if (state.setMousePos)
+		SetMousePosition(int(state.mousePos.x + context->inputOrigin.x), int(state.mousePos.y + context->inputOrigin.y));
+
+	if (!state.changeCursor)
+		return;
+
+	if (state.cursor != CurrentMouseCursor || state.drawCursor)
+	{
+		CurrentMouseCursor = state.cursor;
+		if (state.drawCursor || state.cursor == ImGuiMouseCursor_None)
+		{
+			HideCursor();
+		}
+		else
+		{
+			ShowCursor();
+			SetMouseCursor((state.cursor > -1 && state.cursor < ImGuiMouseCursor_COUNT) ? MouseCursorMap[state.cursor] : MOUSE_CURSOR_DEFAULT);
+		}
+	}
+}
 
+template <typename T>
+static void rlImGuiCopyVector(ImVector<T>& dest, const ImVector<T>& source)
+{
+	// resize keeps the capacity, assigning an ImVector would free and reallocate it every frame
+	dest.resize(source.Size);
+	if (source.Size > 0)
+		memcpy(dest.Data, source.Data, source.size_in_bytes());
+}
+
+// copy the output of ImGui::Render into a frame, ImGui reuses its own lists at the next NewFrame
+static void rlImGuiCopyDrawData(rlImGuiFrame& frame, const ImDrawData* data)
+{
+	while (frame.drawLists.Size < data->CmdListsCount)
+		frame.drawLists.push_back(IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData()));
+
+	frame.drawData.Clear();
+	for (int l = 0; l < data->CmdListsCount; ++l)
+	{
+		const ImDrawList* source = data->CmdLists[l];
+		ImDrawList* commandList = frame.drawLists[l];
+
+		rlImGuiCopyVector(commandList->CmdBuffer, source->CmdBuffer);
+		rlImGuiCopyVector(commandList->IdxBuffer, source->IdxBuffer);
+		rlImGuiCopyVector(commandList->VtxBuffer, source->VtxBuffer);
+		commandList->Flags = source->Flags;
+		frame.drawData.CmdLists.push_back(commandList);
+	}
+
+	frame.drawData.Valid = data->Valid;
+	frame.drawData.CmdListsCount = data->CmdListsCount;
+	frame.drawData.TotalIdxCount = data->TotalIdxCount;
+	frame.drawData.TotalVtxCount = data->TotalVtxCount;
+	frame.drawData.DisplayPos = data->DisplayPos;
+	frame.drawData.DisplaySize = data->DisplaySize;
+	frame.drawData.FramebufferScale = data->FramebufferScale;
+}
+
+// merge the requested glyphs into the ranges of the base fonts, the atlas is rebuilt by the following build
+static void rlImGuiApplyGlyphRanges(rlImGuiContext* context)
+{
+	ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+
+	// remember the ranges each font was added with the first time, later builds extend those
+	for (int i = context->baseGlyphRanges.Size; i < atlas->ConfigData.Size; i++)
+		context->baseGlyphRanges.push_back(atlas->ConfigData[i].GlyphRanges);
+
+	ImFontGlyphRangesBuilder builder = context->requestedGlyphs;
+	for (int i = 0; i < atlas->ConfigData.Size; i++)
+	{
+		if (!atlas->ConfigData[i].MergeMode)
+			builder.AddRanges((context->baseGlyphRanges[i] != nullptr) ? context->baseGlyphRanges[i] : atlas->GetGlyphRangesDefault());
+	}
+
+	context->fontGlyphRanges.clear();
+	builder.BuildRanges(&context->fontGlyphRanges);
+
+	for (int i = 0; i < atlas->ConfigData.Size; i++)
+	{
+		if (!atlas->ConfigData[i].MergeMode)
+			atlas->ConfigData[i].GlyphRanges = context->fontGlyphRanges.Data;
+	}
+
+	atlas->ClearTexData();
+	context->fontGlyphsDirty = false;
+}
+
+// build the atlas of the current ImGui context, the CPU half of a font reload that can run on the frame thread
+static void rlImGuiBuildFontPixels(rlImGuiContext* context, rlImGuiFontPixels& font)
+{
 	ImGuiIO& io = ImGui::GetIO();
-	io.BackendPlatformName = "imgui_impl_raylib";
+	unsigned char* pixels = nullptr;
 
-	io.BackendFlags |= ImGuiBackendFlags_HasMouseCursors;
+	if (context->fontGlyphsDirty)
+		rlImGuiApplyGlyphRanges(context);
 
-	io.MousePos = ImVec2(0, 0);
+	bool alpha8 = rlImGuiUseAlpha8Atlas(context);
+	int bytesPerPixel;
 
-	io.SetClipboardTextFn = rlImGuiSetClipText;
-	io.GetClipboardTextFn = rlImGuiGetClipText;
+	if (alpha8)
+	{
+		io.Fonts->GetTexDataAsAlpha8(&pixels, &font.width, &font.height, &bytesPerPixel);
+		font.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+	}
+	else
+	{
+		io.Fonts->GetTexDataAsRGBA32(&pixels, &font.width, &font.height, &bytesPerPixel);
+		font.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+	}
 
-	io.ClipboardUserData = nullptr;
+	// keep one compact copy, ImGui's own pixel buffers are released
+	font.pixels.resize(font.width * font.height * bytesPerPixel);
+	memcpy(font.pixels.Data, pixels, font.pixels.Size);
+	font.pending = true;
+	io.Fonts->ClearTexData();
 
-	rlImGuiReloadFonts();
+	io.Fonts->TexID = &context->fontTexture;
+}
+
+// the GPU half of a font reload, on the render thread
+static void rlImGuiUploadFontPixels(rlImGuiContext* context, rlImGuiFontPixels& font)
+{
+	Texture2D& texture = context->fontTexture;
+
+	// a rebuild repacks every glyph, so nearly all rows move and diffing against the last upload isn't worth a copy of it,
+	// the texture is only kept (and overwritten whole) when the size and format match
+	if (texture.id != 0 && texture.width == font.width && texture.height == font.height && texture.format == font.format)
+	{
+		rlUpdateTexture(texture.id, 0, 0, font.width, font.height, font.format, font.pixels.Data);
+	}
+	else
+	{
+		if (texture.id != 0)
+			UnloadTexture(texture);
+
+		texture.id = rlLoadTexture(font.pixels.Data, font.width, font.height, font.format, 1);
+		texture.width = font.width;
+		texture.height = font.height;
+		texture.mipmaps = 1;
+		texture.format = font.format;
+	}
+
+	// the GPU has its copy, the CPU one isn't needed until the next rebuild
+	font.pixels.clear();
+	font.pending = false;
 }
 
-void rlSetupKeymap()
+// draw a frame of a context, into its texture when it is off-screen
+static void rlImGuiDrawFrame(rlImGuiContext* context, const ImDrawData* data, const rlImGuiCursorState& cursor)
 {
-	if (!RaylibKeyMap.empty())
+	if (context->target.id != 0)
+	{
+		BeginTextureMode(context->target);
+		ClearBackground(BLANK);
+		rlRenderData(context, data);
+		EndTextureMode();
 		return;
+	}
 
-	// build up a map of raylib keys to ImGuiKeys
-	RaylibKeyMap[KEY_APOSTROPHE] = ImGuiKey_Apostrophe;
-	RaylibKeyMap[KEY_COMMA] = ImGuiKey_Comma;
-	RaylibKeyMap[KEY_MINUS] = ImGuiKey_Minus;
-	RaylibKeyMap[KEY_PERIOD] = ImGuiKey_Period;
-	RaylibKeyMap[KEY_SLASH] = ImGuiKey_Slash;
-	RaylibKeyMap[KEY_ZERO] = ImGuiKey_0;
-	RaylibKeyMap[KEY_ONE] = ImGuiKey_1;
-	RaylibKeyMap[KEY_TWO] = ImGuiKey_2;
-	RaylibKeyMap[KEY_THREE] = ImGuiKey_3;
-	RaylibKeyMap[KEY_FOUR] = ImGuiKey_4;
-	RaylibKeyMap[KEY_FIVE] = ImGuiKey_5;
-	RaylibKeyMap[KEY_SIX] = ImGuiKey_6;
-	RaylibKeyMap[KEY_SEVEN] = ImGuiKey_7;
-	RaylibKeyMap[KEY_EIGHT] = ImGuiKey_8;
-	RaylibKeyMap[KEY_NINE] = ImGuiKey_9;
-	RaylibKeyMap[KEY_SEMICOLON] = ImGuiKey_Semicolon;
-	RaylibKeyMap[KEY_EQUAL] = ImGuiKey_Equal;
-	RaylibKeyMap[KEY_A] = ImGuiKey_A;
-	RaylibKeyMap[KEY_B] = ImGuiKey_B;
-	RaylibKeyMap[KEY_C] = ImGuiKey_C;
-	RaylibKeyMap[KEY_D] = ImGuiKey_D;
-	RaylibKeyMap[KEY_E] = ImGuiKey_E;
-	RaylibKeyMap[KEY_F] = ImGuiKey_F;
-	RaylibKeyMap[KEY_G] = ImGuiKey_G;
-	RaylibKeyMap[KEY_H] = ImGuiKey_H;
-	RaylibKeyMap[KEY_I] = ImGuiKey_I;
-	RaylibKeyMap[KEY_J] = ImGuiKey_J;
-	RaylibKeyMap[KEY_K] = ImGuiKey_K;
-	RaylibKeyMap[KEY_L] = ImGuiKey_L;
-	RaylibKeyMap[KEY_M] = ImGuiKey_M;
-	RaylibKeyMap[KEY_N] = ImGuiKey_N;
-	RaylibKeyMap[KEY_O] = ImGuiKey_O;
-	RaylibKeyMap[KEY_P] = ImGuiKey_P;
-	RaylibKeyMap[KEY_Q] = ImGuiKey_Q;
-	RaylibKeyMap[KEY_R] = ImGuiKey_R;
-	RaylibKeyMap[KEY_S] = ImGuiKey_S;
-	RaylibKeyMap[KEY_T] = ImGuiKey_T;
-	RaylibKeyMap[KEY_U] = ImGuiKey_U;
-	RaylibKeyMap[KEY_V] = ImGuiKey_V;
-	RaylibKeyMap[KEY_W] = ImGuiKey_W;
-	RaylibKeyMap[KEY_X] = ImGuiKey_X;
-	RaylibKeyMap[KEY_Y] = ImGuiKey_Y;
-	RaylibKeyMap[KEY_Z] = ImGuiKey_Z;
-	RaylibKeyMap[KEY_SPACE] = ImGuiKey_Space;
-	RaylibKeyMap[KEY_ESCAPE] = ImGuiKey_Escape;
-	RaylibKeyMap[KEY_ENTER] = ImGuiKey_Enter;
-	RaylibKeyMap[KEY_TAB] = ImGuiKey_Tab;
-	RaylibKeyMap[KEY_BACKSPACE] = ImGuiKey_Backspace;
-	RaylibKeyMap[KEY_INSERT] = ImGuiKey_Insert;
-	RaylibKeyMap[KEY_DELETE] = ImGuiKey_Delete;
-	RaylibKeyMap[KEY_RIGHT] = ImGuiKey_RightArrow;
-	RaylibKeyMap[KEY_LEFT] = ImGuiKey_LeftArrow;
-	RaylibKeyMap[KEY_DOWN] = ImGuiKey_DownArrow;
-	RaylibKeyMap[KEY_UP] = ImGuiKey_UpArrow;
-	RaylibKeyMap[KEY_PAGE_UP] = ImGuiKey_PageUp;
-	RaylibKeyMap[KEY_PAGE_DOWN] = ImGuiKey_PageDown;
-	RaylibKeyMap[KEY_HOME] = ImGuiKey_Home;
-	RaylibKeyMap[KEY_END] = ImGuiKey_End;
-	RaylibKeyMap[KEY_CAPS_LOCK] = ImGuiKey_CapsLock;
-	RaylibKeyMap[KEY_SCROLL_LOCK] = ImGuiKey_ScrollLock;
-	RaylibKeyMap[KEY_NUM_LOCK] = ImGuiKey_NumLock;
-	RaylibKeyMap[KEY_PRINT_SCREEN] = ImGuiKey_PrintScreen;
-	RaylibKeyMap[KEY_PAUSE] = ImGuiKey_Pause;
-	RaylibKeyMap[KEY_F1] = ImGuiKey_F1;
-	RaylibKeyMap[KEY_F2] = ImGuiKey_F2;
-	RaylibKeyMap[KEY_F3] = ImGuiKey_F3;
-	RaylibKeyMap[KEY_F4] = ImGuiKey_F4;
-	RaylibKeyMap[KEY_F5] = ImGuiKey_F5;
-	RaylibKeyMap[KEY_F6] = ImGuiKey_F6;
-	RaylibKeyMap[KEY_F7] = ImGuiKey_F7;
-	RaylibKeyMap[KEY_F8] = ImGuiKey_F8;
-	RaylibKeyMap[KEY_F9] = ImGuiKey_F9;
-	RaylibKeyMap[KEY_F10] = ImGuiKey_F10;
-	RaylibKeyMap[KEY_F11] = ImGuiKey_F11;
-	RaylibKeyMap[KEY_F12] = ImGuiKey_F12;
-	RaylibKeyMap[KEY_LEFT_SHIFT] = ImGuiKey_LeftShift;
-	RaylibKeyMap[KEY_LEFT_CONTROL] = ImGuiKey_LeftCtrl;
-	RaylibKeyMap[KEY_LEFT_ALT] = ImGuiKey_LeftAlt;
-	RaylibKeyMap[KEY_LEFT_SUPER] = ImGuiKey_LeftSuper;
-	RaylibKeyMap[KEY_RIGHT_SHIFT] = ImGuiKey_RightShift;
-	RaylibKeyMap[KEY_RIGHT_CONTROL] = ImGuiKey_RightCtrl;
-	RaylibKeyMap[KEY_RIGHT_ALT] = ImGuiKey_RightAlt;
-	RaylibKeyMap[KEY_RIGHT_SUPER] = ImGuiKey_RightSuper;
-	RaylibKeyMap[KEY_KB_MENU] = ImGuiKey_Menu;
-	RaylibKeyMap[KEY_LEFT_BRACKET] = ImGuiKey_LeftBracket;
-	RaylibKeyMap[KEY_BACKSLASH] = ImGuiKey_Backslash;
-	RaylibKeyMap[KEY_RIGHT_BRACKET] = ImGuiKey_RightBracket;
-	RaylibKeyMap[KEY_GRAVE] = ImGuiKey_GraveAccent;
-	RaylibKeyMap[KEY_KP_0] = ImGuiKey_Keypad0;
-	RaylibKeyMap[KEY_KP_1] = ImGuiKey_Keypad1;
-	RaylibKeyMap[KEY_KP_2] = ImGuiKey_Keypad2;
-	RaylibKeyMap[KEY_KP_3] = ImGuiKey_Keypad3;
-	RaylibKeyMap[KEY_KP_4] = ImGuiKey_Keypad4;
-	RaylibKeyMap[KEY_KP_5] = ImGuiKey_Keypad5;
-	RaylibKeyMap[KEY_KP_6] = ImGuiKey_Keypad6;
-	RaylibKeyMap[KEY_KP_7] = ImGuiKey_Keypad7;
-	RaylibKeyMap[KEY_KP_8] = ImGuiKey_Keypad8;
-	RaylibKeyMap[KEY_KP_9] = ImGuiKey_Keypad9;
-	RaylibKeyMap[KEY_KP_DECIMAL] = ImGuiKey_KeypadDecimal;
-	RaylibKeyMap[KEY_KP_DIVIDE] = ImGuiKey_KeypadDivide;
-	RaylibKeyMap[KEY_KP_MULTIPLY] = ImGuiKey_KeypadMultiply;
-	RaylibKeyMap[KEY_KP_SUBTRACT] = ImGuiKey_KeypadSubtract;
-	RaylibKeyMap[KEY_KP_ADD] = ImGuiKey_KeypadAdd;
-	RaylibKeyMap[KEY_KP_ENTER] = ImGuiKey_KeypadEnter;
-	RaylibKeyMap[KEY_KP_EQUAL] = ImGuiKey_KeypadEqual;
+	rlRenderData(context, data);
+
+	if (context->takesInput)
+		rlImGuiApplyCursorState(context, cursor);
 }
 
-void rlImGuiBeginInitImGui()
+static rlImGuiContext* rlImGuiNewContext()
 {
-	rlSetupKeymap();
-	ImGui::CreateContext(nullptr);
+	rlImGuiContext* context = IM_NEW(rlImGuiContext)();
+	context->imgui = ImGui::CreateContext(nullptr);
+	ContextCount++;
+
+	// input captured before the context existed is not for it, the first frame it begins can capture
+	std::lock_guard<std::mutex> lock(InputMutex);
+	context->inputFrame = Input.frame;
+
+	return context;
 }
 
-void rlImGuiSetup(bool dark)
+// finish setting up a context once its fonts are added, with its ImGui context current
+static void rlImGuiInitContext(rlImGuiContext* context)
 {
-	rlImGuiBeginInitImGui();
+	SetupMouseCursors();
+
+	ImGuiIO& io = ImGui::GetIO();
+	io.BackendPlatformName = "imgui_impl_raylib";
 
+	io.BackendFlags |= ImGuiBackendFlags_HasMouseCursors;
+
+	UseIndexedRendering = rlImGuiCanRenderIndexed();
+	if (UseIndexedRendering)
+	{
+		// draw commands may start past vertex 65535 of a list, the vertex base is moved per command
+		io.BackendRendererName = "rlImGui_indexed";
+		io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+		rlImGuiLoadFontShader();
+	}
+
+	io.MousePos = ImVec2(0, 0);
+
+	// the clipboard goes through the window, off-screen contexts may build their frames on other threads
+	if (context->target.id == 0)
+	{
+		io.SetClipboardTextFn = rlImGuiSetClipText;
+		io.GetClipboardTextFn = rlImGuiGetClipText;
+	}
+
+	io.ClipboardUserData = nullptr;
+
+	rlImGuiReloadFonts();
+}
+
+static void rlImGuiSetupDefaults(bool dark)
+{
 	if (dark)
 		ImGui::StyleColorsDark();
 	else
@@ -421,47 +1144,346 @@ void rlImGuiSetup(bool dark)
 	icons_config.FontDataOwnedByAtlas = false;
 	io.Fonts->AddFontFromMemoryCompressedTTF((void*)fa_solid_900_compressed_data, fa_solid_900_compressed_size, FONT_AWESOME_ICON_SIZE, &icons_config, icons_ranges);
 #endif
+}
+
+void rlImGuiEndInitImGui()
+{
+	rlImGuiInitContext(CurrentContext);
+}
+
+void rlImGuiBeginInitImGui()
+{
+	rlImGuiSetContext(rlImGuiNewContext());
+}
 
+void rlImGuiSetup(bool dark)
+{
+	rlImGuiBeginInitImGui();
+	rlImGuiSetupDefaults(dark);
 	rlImGuiEndInitImGui();
 }
 
 void rlImGuiReloadFonts()
 {
-	ImGuiIO& io = ImGui::GetIO();
-	unsigned char* pixels = nullptr;
+	rlImGuiContext* context = CurrentContext;
+
+	// a rebuild still waiting for the render thread is older than this one
+	{
+		std::lock_guard<std::mutex> lock(context->frameMutex);
+		context->fontUpload.pending = false;
+	}
+
+	rlImGuiBuildFontPixels(context, context->fontBuild);
+	rlImGuiUploadFontPixels(context, context->fontBuild);
+}
+
+void rlImGuiSetFontAtlasAlpha8(bool alpha8)
+{
+	CurrentContext->fontAtlasAlpha8 = alpha8;
+}
+
+// request glyphs, only glyphs neither loaded nor requested before trigger a rebuild
+static void rlImGuiRequestGlyph(rlImGuiContext* context, const ImFont* font, unsigned int c)
+{
+	if (context->requestedGlyphs.GetBit(c))
+		return;
+
+	// glyphs missing from the font files are asked for once
+	context->requestedGlyphs.AddChar(ImWchar(c));
+	if (font == nullptr || font->FindGlyphNoFallback(ImWchar(c)) == nullptr)
+		context->fontGlyphsDirty = true;
+}
 
-	int width;
-	int height;
-	io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height, nullptr);
-	Image image = GenImageColor(width, height, BLANK);
-	memcpy(image.data, pixels, width * height * 4);
+void rlImGuiAddFontGlyphs(const char* text)
+{
+	ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+	const ImFont* font = atlas->Fonts.empty() ? nullptr : atlas->Fonts[0];
 
-	if (FontTexture.id != 0)
-		UnloadTexture(FontTexture);
+	// decode the string in place, codepoints already requested cost a bit test
+	while (*text != 0)
+	{
+		unsigned int c = 0;
+		text += ImTextCharFromUtf8(&c, text, nullptr);
+		if (c != 0 && c <= IM_UNICODE_CODEPOINT_MAX)
+			rlImGuiRequestGlyph(CurrentContext, font, c);
+	}
+}
 
-	FontTexture = LoadTextureFromImage(image);
-	UnloadImage(image);
-	io.Fonts->TexID = &FontTexture;
+void rlImGuiAddFontGlyphRange(unsigned int first, unsigned int last)
+{
+	ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+	const ImFont* font = atlas->Fonts.empty() ? nullptr : atlas->Fonts[0];
+
+	for (unsigned int c = first; c <= last && c <= IM_UNICODE_CODEPOINT_MAX; c++)
+		rlImGuiRequestGlyph(CurrentContext, font, c);
 }
 
 void rlImGuiBegin()
 {
-	rlImGuiNewFrame();
-	rlImGuiEvents();
-	ImGui::NewFrame();
+	rlImGuiContext* context = CurrentContext;
+
+	// raylib's key and char queues drain when read, so input is captured once per frame and shared:
+	// a context that already applied the latest capture is starting a new frame and captures,
+	// the contexts that begin after it in the same frame apply that snapshot
+	bool capture;
+	{
+		std::lock_guard<std::mutex> lock(InputMutex);
+		capture = (context->inputFrame == Input.frame);
+	}
+
+	if (capture)
+		rlImGuiCaptureInput();
+
+	rlImGuiBeginFrame(context);
 }
 
 void rlImGuiEnd()
 {
+	rlImGuiContext* context = CurrentContext;
+
 	ImGui::Render();
-	rlRenderData(ImGui::GetDrawData());
+
+	// the frame is drawn right away, an atlas rebuilt for it is uploaded first
+	if (context->fontBuild.pending)
+		rlImGuiUploadFontPixels(context, context->fontBuild);
+
+	rlImGuiDrawFrame(context, ImGui::GetDrawData(), rlImGuiGetCursorState());
+}
+
+rlImGuiRenderStats rlImGuiGetRenderStats()
+{
+	return CurrentContext->renderStats;
 }
 
 void rlImGuiShutdown()
 {
-	UnloadTexture(FontTexture);
+	rlImGuiDestroyContext(CurrentContext);
+}
+
+rlImGuiContext* rlImGuiCreateContext(int width, int height)
+{
+	rlImGuiContext* previous = CurrentContext;
+	rlImGuiContext* context = rlImGuiNewContext();
+	rlImGuiSetContext(context);
+
+	if (width > 0 && height > 0)
+	{
+		context->target = LoadRenderTexture(width, height);
+		context->takesInput = false;
+	}
+
+	rlImGuiSetupDefaults(true);
+	rlImGuiInitContext(context);
+
+	rlImGuiSetContext(previous);
+	return context;
+}
+
+void rlImGuiDestroyContext(rlImGuiContext* context)
+{
+	if (context == nullptr)
+		return;
+
+	rlImGuiContext* previous = (CurrentContext == context) ? nullptr : CurrentContext;
+	rlImGuiSetContext(context);
+
+	for (rlImGuiFrame& frame : context->frames)
+	{
+		for (ImDrawList* commandList : frame.drawLists)
+			IM_DELETE(commandList);
+	}
+
+	if (context->fontTexture.id != 0)
+		UnloadTexture(context->fontTexture);
+	if (context->target.id != 0)
+		UnloadRenderTexture(context->target);
+	rlImGuiUnloadStreamBuffers(context);
+
+	ImGui::DestroyContext(context->imgui);
+	IM_DELETE(context);
+
+	// the font shader is shared, it goes with the last context
+	if (--ContextCount == 0 && FontShaderId != 0)
+	{
+		rlUnloadShaderProgram(FontShaderId);
+		FontShaderId = 0;
+	}
+
+	rlImGuiSetContext(previous);
+}
+
+void rlImGuiSetContext(rlImGuiContext* context)
+{
+	CurrentContext = context;
+	ImGui::SetCurrentContext((context != nullptr) ? context->imgui : nullptr);
+}
+
+rlImGuiContext* rlImGuiGetContext()
+{
+	return CurrentContext;
+}
+
+void rlImGuiSetContextInput(rlImGuiContext* context, bool enabled, Vector2 origin)
+{
+	context->takesInput = enabled;
+	context->inputOrigin = ImVec2(origin.x, origin.y);
+}
+
+Texture2D rlImGuiGetContextTexture(const rlImGuiContext* context)
+{
+	return context->target.texture;
+}
+
+void rlImGuiCaptureInput()
+{
+	std::lock_guard<std::mutex> lock(InputMutex);
+	Input.frame++;
+
+	if (IsWindowFullscreen())
+	{
+		int monitor = GetCurrentMonitor();
+		Input.displaySize.x = float(GetMonitorWidth(monitor));
+		Input.displaySize.y = float(GetMonitorHeight(monitor));
+	}
+	else
+	{
+		Input.displaySize.x = float(GetScreenWidth());
+		Input.displaySize.y = float(GetScreenHeight());
+	}
+
+	int width = int(Input.displaySize.x), height = int(Input.displaySize.y);
+#ifdef PLATFORM_DESKTOP
+	glfwGetFramebufferSize(glfwGetCurrentContext(), &width, &height);
+#endif
+	if (width > 0 && height > 0) {
+		Input.framebufferScale = ImVec2(width / Input.displaySize.x, height / Input.displaySize.y);
+	}
+	else {
+		Input.framebufferScale = ImVec2(1.0f, 1.0f);
+	}
+
+	Input.deltaTime = GetFrameTime();
+
+	Input.mousePos.x = (float)GetMouseX();
+	Input.mousePos.y = (float)GetMouseY();
+
+	Input.mouseDown[0] = IsMouseButtonDown(MOUSE_LEFT_BUTTON);
+	Input.mouseDown[1] = IsMouseButtonDown(MOUSE_RIGHT_BUTTON);
+	Input.mouseDown[2] = IsMouseButtonDown(MOUSE_MIDDLE_BUTTON);
+
+	if (GetMouseWheelMove() > 0)
+		Input.mouseWheel = 1;
+	else if (GetMouseWheelMove() < 0)
+		Input.mouseWheel = -1;
+	else
+		Input.mouseWheel = 0;
+
+	Input.keyCtrl = IsKeyDown(KEY_RIGHT_CONTROL) || IsKeyDown(KEY_LEFT_CONTROL);
+	Input.keyShift = IsKeyDown(KEY_RIGHT_SHIFT) || IsKeyDown(KEY_LEFT_SHIFT);
+	Input.keyAlt = IsKeyDown(KEY_RIGHT_ALT) || IsKeyDown(KEY_LEFT_ALT);
+	Input.keySuper = IsKeyDown(KEY_RIGHT_SUPER) || IsKeyDown(KEY_LEFT_SUPER);
+
+	// look for any keys that were down last frame and see if they were released
+	for (int i = 0; i < Input.downKeyCount; )
+	{
+		if (IsKeyDown(Input.downKeys[i]))
+			i++;
+		else
+			Input.downKeys[i] = Input.downKeys[--Input.downKeyCount];
+	}
+
+	// get the pressed keys, they are in event order
+	Input.pressedKeys.resize(0);
+	int keyId = GetKeyPressed();
+	while (keyId != 0)
+	{
+		if (rlImGuiTranslateKey(keyId) != ImGuiKey_None)
+		{
+			Input.pressedKeys.push_back(KeyboardKey(keyId));
+
+			bool tracked = false;
+			for (int i = 0; i < Input.downKeyCount && !tracked; i++)
+				tracked = (Input.downKeys[i] == keyId);
+
+			if (!tracked)
+				Input.downKeys[Input.downKeyCount++] = KeyboardKey(keyId);
+		}
+		keyId = GetKeyPressed();
+	}
+
+	// add the text input in order
+	Input.characters.resize(0);
+	unsigned int pressed = GetCharPressed();
+	while (pressed != 0)
+	{
+		Input.characters.push_back(pressed);
+		pressed = GetCharPressed();
+	}
+}
+
+void rlImGuiBeginFrame(rlImGuiContext* context)
+{
+	rlImGuiSetContext(context);
+
+	// the atlas can't change during a frame, glyphs requested since the last one are added now
+	if (context->fontGlyphsDirty)
+		rlImGuiBuildFontPixels(context, context->fontBuild);
+
+	rlImGuiApplyInput(context);
+	ImGui::NewFrame();
+}
+
+void rlImGuiEndFrame(rlImGuiContext* context)
+{
+	ImGui::Render();
+
+	rlImGuiFrame& frame = context->frames[context->buildFrame];
+	rlImGuiCopyDrawData(frame, ImGui::GetDrawData());
+	frame.cursor = rlImGuiGetCursorState();
+
+	std::lock_guard<std::mutex> lock(context->frameMutex);
+	std::swap(context->buildFrame, context->readyFrame);
+	context->frameReady = true;
+
+	// a rebuilt atlas travels with the frame that first uses it, a newer one replaces one the render thread hasn't taken yet
+	if (context->fontBuild.pending)
+	{
+		rlImGuiFontPixels& build = context->fontBuild;
+		rlImGuiFontPixels& upload = context->fontUpload;
+		upload.pixels.swap(build.pixels);
+		upload.width = build.width;
+		upload.height = build.height;
+		upload.format = build.format;
+		upload.pending = true;
+		build.pending = false;
+	}
+}
+
+void rlImGuiRenderContext(rlImGuiContext* context)
+{
+	bool newFrame = false;
+	{
+		std::lock_guard<std::mutex> lock(context->frameMutex);
+		if (context->frameReady)
+		{
+			std::swap(context->readyFrame, context->drawFrame);
+			context->frameReady = false;
+			newFrame = true;
+		}
+
+		if (context->fontUpload.pending)
+			rlImGuiUploadFontPixels(context, context->fontUpload);
+	}
+
+	const rlImGuiFrame& frame = context->frames[context->drawFrame];
+	if (!frame.drawData.Valid)
+		return;
+
+	// an off-screen texture keeps its content, it's only redrawn for a new frame
+	if (context->target.id != 0 && !newFrame)
+		return;
 
-	ImGui::DestroyContext();
+	rlImGuiDrawFrame(context, &frame.drawData, frame.cursor);
 }
 
 void rlImGuiImage(const Texture* image)
@@ -39,6 +39,18 @@
 #define FONT_AWESOME_ICON_SIZE 11
 #endif
 
+// draw statistics of the last rlImGuiEnd
+typedef struct rlImGuiRenderStats
+{
+	int commands;			// draw commands received from ImGui
+	int draws;				// draw calls issued after merging commands
+	int scissorChanges;
+	int textureBinds;
+} rlImGuiRenderStats;
+
+// rlImGui state of one ImGui context
+typedef struct rlImGuiContext rlImGuiContext;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -48,12 +60,32 @@ void rlImGuiSetup(bool dark);
 void rlImGuiBegin();
 void rlImGuiEnd();
 void rlImGuiShutdown();
+rlImGuiRenderStats rlImGuiGetRenderStats();
 
 // Advanced StartupAPI
 void rlImGuiBeginInitImGui();
 void rlImGuiEndInitImGui();
 void rlImGuiReloadFonts();
 
+// font API
+void rlImGuiSetFontAtlasAlpha8(bool alpha8);								// coverage only atlas (default), applied by the next rlImGuiReloadFonts, needs OpenGL 2.1+
+void rlImGuiAddFontGlyphs(const char* text);								// load the glyphs of a UTF-8 string that aren't in the atlas yet, at the start of the next frame
+void rlImGuiAddFontGlyphRange(unsigned int first, unsigned int last);	// same for a codepoint range
+
+// context API, the other functions work on the calling thread's current context (rlImGuiSetup creates one and makes it current)
+// a context's frame can be built on any thread, one at a time, between rlImGuiBeginFrame and rlImGuiEndFrame; rlImGuiRenderContext draws it on the render thread
+// NOTE: building frames on worker threads needs ImGui compiled with IMGUI_USER_CONFIG="rlImGuiConfig.h", which makes ImGui's current context per thread
+rlImGuiContext* rlImGuiCreateContext(int width, int height);						// render thread, dark style and default font, width and height > 0 make an off-screen context drawn to a texture
+void rlImGuiDestroyContext(rlImGuiContext* context);								// render thread
+void rlImGuiSetContext(rlImGuiContext* context);									// also makes its ImGui context current
+rlImGuiContext* rlImGuiGetContext();
+void rlImGuiSetContextInput(rlImGuiContext* context, bool enabled, Vector2 origin);	// off-screen contexts take no input until enabled, origin is where the context is shown in the window
+Texture2D rlImGuiGetContextTexture(const rlImGuiContext* context);					// off-screen result, upside down like any render texture
+void rlImGuiCaptureInput();														// render thread, once per frame before the contexts begin theirs (rlImGuiBegin calls it for the first context of a frame)
+void rlImGuiBeginFrame(rlImGuiContext* context);									// makes the context current on the calling thread
+void rlImGuiEndFrame(rlImGuiContext* context);										// generates the draw lists and hands a copy to the render thread
+void rlImGuiRenderContext(rlImGuiContext* context);								// render thread, draws the last ended frame (off-screen textures are only redrawn for a new one)
+
 // image API
 void rlImGuiImage(const Texture *image);
 bool rlImGuiImageButton(const char* name, const Texture *image);